@@ -48,6 +48,8 @@
 #define F_BAND_OPTION             11
 #define R_BAND_OPTION             12
 #define L_BAND_OPTION             13
+#define LOS_WARNING_OPTION        14
+#define REACQUIRE_OPTION          15
 
 #define BATTERY_ALARM_DEFAULT     1   /* On    */
 #define ALARM_LEVEL_DEFAULT       5   /* value 1-8   */
@@ -63,13 +65,15 @@
 #define R_BAND_DEFAULT            1   /* On */
 #define L_BAND_DEFAULT            1   /* On */
 #define BATTERY_TEXT_DEFAULT      0   /* Off */
+#define LOS_WARNING_DEFAULT       1   /* Text, LOS_WARNING */
+#define REACQUIRE_DEFAULT         0   /* Off */
 
-#define MAX_OPTIONS               14
+#define MAX_OPTIONS               16
 
 // User Configuration Commands
-#define TEST_ALARM_COMMAND        14
-#define RESET_SETTINGS_COMMAND    15
-#define EXIT_COMMAND              16
+#define TEST_ALARM_COMMAND        16
+#define RESET_SETTINGS_COMMAND    17
+#define EXIT_COMMAND              18
 #define MAX_COMMANDS              3
 
 // Number of lines in configuration menu
@@ -79,8 +83,6 @@
 // battery text needs 4 chars extra in worst case 
 // (3 digits + %)
 #define BATTERY_TEXT_WIDTH 4
-// offset from battery symbol to text on the left info line
-#define BATTERY_SYMBOL_X_OFFSET_LEFT 2
 
 // Minimum time info is shown on screen
 #define FORCED_SCREEN_UPDATE_MS   6000
@@ -108,8 +110,26 @@
 // Minimum delay between setting a channel and trusting the RSSI values
 #define RSSI_STABILITY_DELAY_MS   25
 
-// RSSI threshold for accepting a channel
-#define RSSI_TRESHOLD             250
+// RSSI range of the receiver module. The range is calibrated from the lowest
+// noise floor and the highest RSSI seen and is stored in EEPROM, until then
+// the defaults apply.
+#define RSSI_MIN_DEFAULT          140
+#define RSSI_MAX_DEFAULT          500
+// A channel is accepted when its RSSI is RSSI_SNR_PERCENT of the calibrated
+// range above the noise floor. The noise floor is tracked per segment of the
+// band, since the noise of a venue is rarely the same over the whole band.
+#define RSSI_SNR_PERCENT          25
+#define NOISE_SEGMENT_MIN         5345
+#define NOISE_SEGMENT_MHZ         100
+#define NOISE_SEGMENTS            6
+// At start the noise floor of a segment is measured as the lowest of
+// NOISE_SAMPLES samples spread over the segment
+#define NOISE_SAMPLES             5
+// The calibrated range shrinks by 1/RSSI_RANGE_DECAY of its excess over
+// RSSI_RANGE_MIN per start, so a single strong sample does not raise the
+// threshold for good
+#define RSSI_RANGE_DECAY          8
+#define RSSI_RANGE_MIN            100
 
 // Channels in use 
 #define CHANNEL_MIN               (options[L_BAND_OPTION] ? 0 : 8)
@@ -128,6 +148,68 @@
 #define EEPROM_CHANNEL            0
 #define EEPROM_OPTIONS            1
 #define EEPROM_CHECK              (EEPROM_OPTIONS + MAX_OPTIONS)
+#define EEPROM_TEMPLATE_HASH      (EEPROM_CHECK + 1)  /* 2 bytes */
+#define EEPROM_RSSI_MIN           (EEPROM_TEMPLATE_HASH + 2)  /* 2 bytes */
+#define EEPROM_RSSI_MAX           (EEPROM_RSSI_MIN + 2)       /* 2 bytes */
+
+// Screen template ids
+#define TEMPLATE_LOGO             0
+#define TEMPLATE_VERSION_DATE     1
+#define TEMPLATE_VERSION_INFO     2
+#define TEMPLATE_SCANNER_BAR      3
+#define TEMPLATE_SCANNER_LABELS   4
+#define TEMPLATE_SCANNER_LABELS_L 5
+#define TEMPLATE_OPTION_LABELS    6   /* One per option and command */
+#define MAX_TEMPLATES             (TEMPLATE_OPTION_LABELS + MAX_OPTIONS + MAX_COMMANDS)
+
+// Time for the MinimOSD to boot before it can receive templates
+#define MINIMOSD_BOOT_TIME_MS     5000
+// The MinimOSD needs about 3.3 ms to write a template byte to EEPROM.
+// Only used if the MinimOSD does not send status frames.
+#define TEMPLATE_BYTE_DELAY_MS    4
+// Template uploads per boot, so a MinimOSD that fails to store them is not
+// flooded with uploads
+#define TEMPLATE_UPLOAD_TRIES     3
+// Flow control is turned off if no status frame arrives within this time
+#define OSD_STATUS_TIMEOUT_MS     500
+// The scanner graph sits on the bottom lines, which depend on the video format
+#define SCANNER_BAR_LINE_NTSC     11
+#define SCANNER_BAR_LINE_PAL      14
+// Rows of scanner bars ending at the bar line. The row above them holds the
+// scanner cursor.
+#define SCANNER_ROWS              11
+// The scanner keeps the last sweeps as 4-bit levels, two bins per byte.
+// A bin is one SCANNING_STEP, two bins make a scanner column.
+#define HISTORY_SWEEPS            8
+#define HISTORY_BINS              60
+#define HISTORY_BYTES             (HISTORY_SWEEPS * HISTORY_BINS / 2)
+// Level a peak needs to be a hot frequency for the scanner cursor
+#define HISTORY_HOT_LEVEL         3
+#define ZOOM_HOT_LEVEL            6
+// The zoomed scanner shows one column per ZOOM_STEP MHz. Small steps settle
+// faster than jumps across the band, so a shorter delay is used between them.
+#define ZOOM_STEP                 2
+#define ZOOM_STABILITY_DELAY_MS   10
+// The signal watchdog sweeps REACQUIRE_WINDOW_MHZ around the last good
+// frequency when the RSSI stays below the threshold for REACQUIRE_DELAY_MS.
+// The threshold is halfway between the noise floor and the learned RSSI.
+#define REACQUIRE_WINDOW_MHZ      10
+#define REACQUIRE_DELAY_MS        2000
+
+// Set to 1 to time the hot functions at start, see runBenchmarks
+#define BENCHMARKS                0
+#define BENCHMARK_CALLS           30
+
+// OSD traffic is counted per screen
+#define TRAFFIC_OTHER             0
+#define TRAFFIC_INFO_LINE         1
+#define TRAFFIC_START_SCREEN      2
+#define TRAFFIC_SCANNER           3
+#define TRAFFIC_OPTIONS           4
+#define TRAFFIC_SCREENS           5
+#define OSD_COLUMNS               30
+#define OSD_BAUD_RATE             57600
+#define OSD_CURSOR_UNKNOWN        0xFF
 
 // click types
 #define NO_CLICK                  0
@@ -135,6 +217,10 @@
 #define DOUBLE_CLICK              2
 #define LONG_CLICK                3
 #define WAKEUP_CLICK              4
+#define VERY_LONG_CLICK           5   /* Hidden, shows the debug page */
+
+// Button hold time for a VERY_LONG_CLICK
+#define VERY_LONG_CLICK_MS        3000
 
 // Button pins go low or high on button clicks
 #define BUTTON_PRESSED            LOW
@@ -146,6 +232,6 @@
 // Release information
 #define VER_DATE_STRING           "2017-03-13"
 #define VER_INFO_STRING           "v2.3 by Dvogonen"
-#define VER_EEPROM                241
+#define VER_EEPROM                243
 
 #endif // cyclop_plus_osd_h
@@ -39,17 +39,19 @@
 #include <string.h>
 #include <EEPROM.h>
 #include <EnableInterrupt.h>
+#include <util/crc16.h>
 
 /*******************************************************************************
-  Minimosd Display Protocol Definition v1.0
-   Formal definition for the display protocol: (Token[Command[Param]])*
+  Minimosd Display Protocol Definition v1.1
+   Formal definition for the display protocol: (Token[Command[Param*]])*
    Tokens,  commands and params are all bytes.
    All tokens except CMD_CMD results in the corresponding character in the Max7456
    charmap being displayed onscreen  att current position using current params.
    The token CMD_CMD signals that the next byte is a command.
-   Some commands have a single param.
+   Some commands have one or more params. Params are never CMD_CMD.
    Invalid characters are ignored (e.g. unknown commands, params that are out of
    bounds, etc).
+   The MinimOSD answers with status frames on its TX line, see below.
  *******************************************************************************
   Protocol Commands:
  *******************************************************************************/
@@ -69,6 +71,100 @@
 #define CMD_NEWLINE         13  /* Moves cursor to start of the next line      */
 #define CMD_SET_X           14  /* Position X cursor (next char is a parameter)*/
 #define CMD_SET_Y           15  /* Position Y cursor (next char is a parameter)*/
+#define CMD_INFO_LINE       16  /* Draw the info line (7 params, see below)    */
+#define CMD_DRAW_TEMPLATE   17  /* Draw template (params: id, x, y)            */
+#define CMD_LOAD_TEMPLATES  18  /* Store templates (5 params + data, see below)*/
+#define CMD_SET_LOS_MODE    19  /* Loss of sync display (param: LOS_xxx)       */
+#define CMD_DUMP_SCREEN     20  /* Print the screen as text on the TX line     */
+#define CMD_SEND_COUNTERS   21  /* Answer with a counters frame, see below     */
+#define CMD_SURVEY_DATA     22  /* Survey data (2 params + data, see below)    */
+/*******************************************************************************
+  Loss of Sync Modes:
+   The MinimOSD watches the video sync itself and covers the screen with a
+   warning while sync is lost. The previous screen returns with the sync.
+ *******************************************************************************/
+#define LOS_NONE            0   /* No loss of sync display                     */
+#define LOS_WARNING         1   /* Blinking warning text                       */
+#define LOS_GRAY            2   /* Warning text on a gray background           */
+/*******************************************************************************
+  Info Line Packet:
+   The params of CMD_INFO_LINE are raw values. All params are 7 bit values.
+   The MinimOSD formats the values and places the info line on screen itself.
+ *******************************************************************************/
+#define INFO_LINE_PARAMS    7   /* Number of params in an info line packet     */
+#define INFO_FLAG_LEFT      0x01 /* Info line on the left side of the screen   */
+#define INFO_FLAG_BAT_TEXT  0x02 /* Show battery percentage as text            */
+/*******************************************************************************
+  Screen Templates:
+   Static screen parts are stored as templates in the MinimOSD EEPROM and are
+   drawn with CMD_DRAW_TEMPLATE. A template is a byte stream in the display
+   protocol format. CMD_SET_X and CMD_SET_Y in a template are relative to the
+   x and y params of CMD_DRAW_TEMPLATE.
+   CMD_LOAD_TEMPLATES params: 16 bit CRC of the template image as 2+7+7 bits,
+   image length as 7+7 bits. The image follows as raw bytes.
+   Image format: template count, count+1 little endian 16 bit offsets to the
+   start of each template (the last offset is the image length), templates.
+ *******************************************************************************/
+#define LOAD_TEMPLATES_PARAMS 5
+/*******************************************************************************
+  Survey Data:
+   Survey frames are sent for logging by tapping the CYCLOP++ TX line, see
+   survey/survey2csv.py. The MinimOSD skips them.
+   CMD_SURVEY_DATA params: frame length as 7+7 bits. The frame follows as raw
+   bytes. Multi byte values are little endian.
+   Sweep frame: SURVEY_SWEEP, time in ms (4), first frequency in MHz (2),
+   frequency step in MHz (1), bin count (1), RSSI / 4 of each bin (1 each).
+   Sample frame: SURVEY_SAMPLE, time in ms (4), frequency in MHz (2),
+   RSSI (2), battery voltage in 0.1 V (2).
+ *******************************************************************************/
+#define SURVEY_SWEEP        1
+#define SURVEY_SAMPLE       2
+#define SURVEY_SWEEP_HEADER 9   /* Sweep frame size without the bins           */
+#define SURVEY_SAMPLE_SIZE  11
+#define SURVEY_MAX_BINS     64
+/*******************************************************************************
+  Status Frames (MinimOSD to CYCLOP++):
+   Format: STATUS_START, frame type, params. Params are 7 bit values.
+   Status frames are sent periodically and as soon as a quarter of the receive
+   buffer has been consumed. The sender may have at most STATUS_BUFFER_SIZE
+   bytes in flight, i.e. sent but not yet counted in STATUS_CONSUMED or
+   STATUS_OVERFLOWS. The counters start at 0 when the MinimOSD boots, which
+   the sender sees as a new STATUS_EPOCH.
+   A counters frame is sent as the answer to CMD_SEND_COUNTERS. Counters are
+   21 bit values sent as 3 params, bits 14-20 first. They wrap around.
+ *******************************************************************************/
+#define STATUS_START        255 /* Start of a status frame                     */
+#define STATUS_FRAME        1   /* Frame type: flow control and status         */
+#define STATUS_PARAMS       11  /* Number of params in a status frame          */
+#define STATUS_CONSUMED_HI  0   /* Bytes consumed, 14 bit counter, bits 7-13   */
+#define STATUS_CONSUMED_LO  1   /* Bytes consumed, 14 bit counter, bits 0-6    */
+#define STATUS_BUFFER_SIZE  2   /* Receive buffer size / 8                     */
+#define STATUS_VIDEO        3   /* Active video format: VIDEO_NTSC or VIDEO_PAL*/
+#define STATUS_OVERFLOWS_HI 4   /* Lost received bytes, 14 bit counter, 7-13   */
+#define STATUS_OVERFLOWS_LO 5   /* Lost received bytes, 14 bit counter, 0-6    */
+#define STATUS_TEMPLATE_HI  6   /* CRC of stored templates, bits 14-15         */
+#define STATUS_TEMPLATE_MID 7   /* CRC of stored templates, bits 7-13          */
+#define STATUS_TEMPLATE_LO  8   /* CRC of stored templates, bits 0-6           */
+#define STATUS_EPOCH        9   /* Boots modulo 128, new when counters restart */
+#define STATUS_CHECK        10  /* XOR of the frame type and params 0-9        */
+
+#define STATUS_COUNTERS     2   /* Frame type: profiling counters              */
+#define COUNTERS_PARAMS     16  /* Number of params in a counters frame        */
+#define COUNTERS_RX_BYTES   0   /* Bytes received                              */
+#define COUNTERS_OVERFLOWS  3   /* Lost received bytes                         */
+#define COUNTERS_SPI_BYTES  6   /* Bytes transferred to and from the max7456   */
+#define COUNTERS_BUSY_WAIT  9   /* Time spent waiting for the max7456 in ms    */
+#define COUNTERS_MAX_CELLS  12  /* Most cells written in a field since the     */
+                                /* previous counters frame                     */
+#define COUNTERS_CHECK      15  /* XOR of the frame type and params 0-14       */
+#define COUNTERS_COUNT      5   /* Number of counters in a counters frame      */
+#define COUNTERS_MASK       0x1FFFFFUL  /* Counters are 21 bit values          */
+
+#define VIDEO_NTSC          0
+#define VIDEO_PAL           1
+#define VIDEO_NONE          2
+
+#define OSD_COUNTER_MASK    0x3FFF  /* Sent and consumed are 14 bit counters   */
 //******************************************************************************
 //* Character constants
 
@@ -102,35 +198,81 @@
 //******************************************************************************
 //* File scope function declarations
 
+void          addSample( struct Profile &profile, unsigned long time );
 unsigned int  autoScan( unsigned int frequency );
 unsigned int  averageAnalogRead( unsigned char pin );
+unsigned long averageSample( const struct Profile &profile );
+unsigned char batteryLevel( void );
 void          batteryMeter(unsigned char x, unsigned char y);
 unsigned char bestChannelMatch( unsigned int frequency );
 void          buttonPressInterrupt();
 void          drawAutoScanScreen(void);
 void          drawBattery(unsigned char xPos, unsigned char yPos, unsigned char value, bool showNumbers = false );
-void          drawLeftInfoLine( void );
+void          drawDebugLine( unsigned char line, const char *label, const unsigned long *values, unsigned char count );
+void          drawDebugScreen( void );
+unsigned char drawFunctionScreen( unsigned char function );
+void          drawInfoLine( void );
 void          drawLogo( unsigned char xPos, unsigned char yPos);
 void          drawOptionsScreen(unsigned char option, unsigned char in_edit_state );
-void          drawRightInfoLine( void );
+unsigned char barGlyph( unsigned char value1, unsigned char value2, unsigned char row );
+void          drawScannerCursor( unsigned char column, unsigned int frequency );
 void          drawScannerScreen( void );
 void          drawStartScreen(void);
 unsigned char getClickType(unsigned char buttonPin);
+unsigned char getMenuClickType(unsigned char buttonPin);
 unsigned int  getVoltage( void );
 unsigned int  graphicScanner( unsigned int frequency );
+unsigned char historyLevel( unsigned char sweep, unsigned char bin );
+unsigned char hotIndex( const unsigned char *levels, unsigned char count, unsigned char index, bool forward, unsigned char hot );
 char         *longNameOfChannel(unsigned char channel, char *name);
 unsigned char nextChannel( unsigned char channel);
 void          osd( unsigned char command );
+unsigned int  osd_credits( void );
+void          osd_flush( void );
+void          osd_poll( void );
+void          osd_reserve( unsigned char size );
+void          osd_status( const unsigned char *params );
 void          osd( unsigned char command, unsigned char param );
+void          osd_advance( unsigned char count );
 void          osd_char( unsigned char token );
+void          osd_counters( const unsigned char *params );
 void          osd_int( unsigned int integer );
+void          osd_long( unsigned long integer );
+void          osd_raw( const unsigned char *data, unsigned char size );
 void          osd_string( const char *str );
+void          osd_survey( const unsigned char *data, unsigned char size );
+void          osd_template( unsigned char id, unsigned char xPos, unsigned char yPos );
+void          measureNoiseFloor( void );
+unsigned char noiseSegment( unsigned int frequency );
 unsigned char previousChannel( unsigned char channel);
+void          readCalibration( void );
+unsigned int  reacquireSignal( unsigned int frequency, unsigned int threshold );
 bool          readEeprom(void);
 void          resetOptions(void);
-char         *shortNameOfChannel(unsigned char channel, char *name);
+void          resetProfiling( void );
+unsigned char rssiLevel( unsigned int frequency, unsigned int rssi, unsigned char top );
+unsigned int  rssiThreshold( unsigned int frequency );
+unsigned char peakLevel( unsigned char bin );
+void          runBenchmarks( void );
+void          saveCalibration( void );
+void          setHistoryLevel( unsigned char sweep, unsigned char bin, unsigned char level );
+unsigned char selectFunction( void );
 void          setOptions( void );
+void          storeLittleEndian( unsigned char *data, unsigned long value, unsigned char size );
+void          storeTemplateHash( unsigned int hash );
+void          survey( void );
+void          showDebugScreen( void );
+unsigned int  templateImage( bool send );
+void          testAlarm( void );
+void          trackRssi( unsigned int frequency, unsigned int rssi );
+void          updateSoftPositions( void );
+void          updateTemplates( void );
+void          uploadTemplates( void );
+void          waitForOsd( unsigned long timeout );
+void          watchSignal( void );
+void          writeEeprom( void );
 void          updateScannerScreen(unsigned char position, unsigned char value1, unsigned char value2 );
+unsigned int  zoomScanner( unsigned int frequency );
 
 //******************************************************************************
 //* Positions in the frequency table for the 48 channels
@@ -182,6 +324,79 @@ unsigned int getReversePosition( unsigned char position ) {
   return pgm_read_word_near(reversePositions + position);
 }
 
+//******************************************************************************
+//* Screen templates uploaded to the MinimOSD EEPROM.
+//* The templates are drawn with osd_template. The order of the option label
+//* templates must follow the option and command numbers.
+
+const unsigned char logoTemplate[] PROGMEM = {
+  CMD_CMD, CMD_ENABLE_INVERSE,
+  OSD_LOGO,     OSD_LOGO + 1,  OSD_LOGO + 2,  OSD_LOGO + 3,
+  OSD_LOGO + 4, OSD_LOGO + 5,  OSD_LOGO + 6,  OSD_LOGO + 7,
+  CMD_CMD, CMD_SET_X, 0, CMD_CMD, CMD_SET_Y, 1,
+  OSD_LOGO + 8,  OSD_LOGO + 9,  OSD_LOGO + 10, OSD_LOGO + 11,
+  OSD_LOGO + 12, OSD_LOGO + 13, OSD_LOGO + 14, OSD_LOGO + 15,
+  CMD_CMD, CMD_DISABLE_INVERSE
+};
+const unsigned char scannerBarTemplate[] PROGMEM = {
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY,
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY,
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY,
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY,
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY,
+  OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY, OSD_BAR_EMPTY
+};
+const unsigned char versionDateTemplate[]   PROGMEM = VER_DATE_STRING;
+const unsigned char versionInfoTemplate[]   PROGMEM = VER_INFO_STRING;
+const unsigned char scannerLabelTemplate[]  PROGMEM = " 5.65       5.80       5.95";
+const unsigned char scannerLabelLTemplate[] PROGMEM = " 5.35       5.60       5.95";
+const unsigned char label00Template[] PROGMEM = "battery alarm      ";
+const unsigned char label01Template[] PROGMEM = "alarm sound level  ";
+const unsigned char label02Template[] PROGMEM = "battery type       ";
+const unsigned char label03Template[] PROGMEM = "volt calibration   ";
+const unsigned char label04Template[] PROGMEM = "show bat percentage";
+const unsigned char label05Template[] PROGMEM = "show start screen  ";
+const unsigned char label06Template[] PROGMEM = "constant info line ";
+const unsigned char label07Template[] PROGMEM = "info line position ";
+const unsigned char label08Template[] PROGMEM = "boscam a band      ";
+const unsigned char label09Template[] PROGMEM = "boscam b band      ";
+const unsigned char label10Template[] PROGMEM = "foxtech/dji band   ";
+const unsigned char label11Template[] PROGMEM = "fatshark band      ";
+const unsigned char label12Template[] PROGMEM = "race band          ";
+const unsigned char label13Template[] PROGMEM = "low band           ";
+const unsigned char label14Template[] PROGMEM = "no signal warning  ";
+const unsigned char label15Template[] PROGMEM = "signal reacquire   ";
+const unsigned char label16Template[] PROGMEM = "test alarm         ";
+const unsigned char label17Template[] PROGMEM = "reset settings     ";
+const unsigned char label18Template[] PROGMEM = "exit               ";
+
+const unsigned char * const templates[MAX_TEMPLATES] PROGMEM = {
+  logoTemplate, versionDateTemplate, versionInfoTemplate, scannerBarTemplate,
+  scannerLabelTemplate, scannerLabelLTemplate,
+  label00Template, label01Template, label02Template, label03Template,
+  label04Template, label05Template, label06Template, label07Template,
+  label08Template, label09Template, label10Template, label11Template,
+  label12Template, label13Template, label14Template, label15Template,
+  label16Template, label17Template, label18Template
+};
+
+// Text templates are stored without their terminating zero
+const unsigned char templateSizes[MAX_TEMPLATES] PROGMEM = {
+  sizeof(logoTemplate), sizeof(versionDateTemplate) - 1,
+  sizeof(versionInfoTemplate) - 1, sizeof(scannerBarTemplate),
+  sizeof(scannerLabelTemplate) - 1, sizeof(scannerLabelLTemplate) - 1,
+  sizeof(label00Template) - 1, sizeof(label01Template) - 1,
+  sizeof(label02Template) - 1, sizeof(label03Template) - 1,
+  sizeof(label04Template) - 1, sizeof(label05Template) - 1,
+  sizeof(label06Template) - 1, sizeof(label07Template) - 1,
+  sizeof(label08Template) - 1, sizeof(label09Template) - 1,
+  sizeof(label10Template) - 1, sizeof(label11Template) - 1,
+  sizeof(label12Template) - 1, sizeof(label13Template) - 1,
+  sizeof(label14Template) - 1, sizeof(label15Template) - 1,
+  sizeof(label16Template) - 1, sizeof(label17Template) - 1,
+  sizeof(label18Template) - 1
+};
+
 //******************************************************************************
 //* Other file scope variables
 unsigned char lastClick = NO_CLICK;
@@ -203,14 +418,70 @@ unsigned char saveScreenActive = 0;
 unsigned char screenCleaning = 0;
 rtc6715 receiver( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
 unsigned char softPositions[48];
+unsigned int  templateHash = 0;
+unsigned char templateUploads = 0;            // Uploads since boot
+unsigned char scannerBarLine = SCANNER_BAR_LINE_NTSC;
+unsigned char scannerCursor = OSD_COLUMNS;    // Column of the shown cursor, OSD_COLUMNS = none
+unsigned char scanHistory[HISTORY_BYTES];     // Packed levels of the last sweeps
+unsigned char historySweep = 0;               // Sweep being written
+unsigned int  signalRssi = 0;                 // Last info line RSSI sample
+unsigned int  goodRssi = 0;                   // Learned RSSI of a good signal
+unsigned int  goodFrequency = 0;              // Last frequency with a good signal
+unsigned long signalLostTime = 0;             // Start of a weak signal, 0 if good
+unsigned int  rssiMin = RSSI_MIN_DEFAULT;     // Calibrated RSSI range
+unsigned int  rssiMax = RSSI_MAX_DEFAULT;
+bool          calibrationChanged = false;     // The range needs an EEPROM save
+unsigned int  noiseFloor[NOISE_SEGMENTS];     // Running noise floor estimates
+
+//******************************************************************************
+//* MinimOSD state as reported in status frames
+unsigned int  osdSent = 0;            // Bytes sent, 14 bit counter
+unsigned int  osdConsumed = 0;        // Bytes consumed by the MinimOSD
+unsigned int  osdBufferSize = 0;      // 0 if there is no flow control
+unsigned char osdVideoFormat = VIDEO_NONE;
+unsigned int  osdOverflows = 0;        // Bytes lost by the MinimOSD, 14 bit counter
+unsigned char osdEpoch = 0xFF;         // STATUS_EPOCH of the last frame, 0xFF = none
+unsigned int  osdTemplateHash = 0;
+unsigned long osdStatusTime = 0;      // Time of the last status frame
+
+//******************************************************************************
+//* OSD traffic, counted per screen. osdScreen is set by the draw functions.
+//* The MinimOSD cursor is tracked to find cursor moves that change nothing.
+struct OsdTraffic {
+  unsigned long bytes;                // Bytes sent
+  unsigned int  commands;             // Commands sent
+  unsigned int  redundantMoves;       // CMD_SET_X/Y to the current position
+};
+OsdTraffic    osdTraffic[TRAFFIC_SCREENS];
+unsigned char osdScreen = TRAFFIC_OTHER;
+unsigned char osdCursorX = OSD_CURSOR_UNKNOWN;
+unsigned char osdCursorY = OSD_CURSOR_UNKNOWN;
+
+//******************************************************************************
+//* Profiling counters, shown on the debug page. Times are in microseconds.
+//* Totals wrap after about an hour, a reset starts over.
+struct Profile {
+  unsigned long total;                // Sum of all samples
+  unsigned long min;
+  unsigned long max;
+  unsigned long count;                // Number of samples
+};
+Profile       profileLoop;            // Time between loop passes
+Profile       profileOsdWait;         // Time blocked in osd_reserve
+Profile       profileAdc;             // Time in averageAnalogRead
+Profile       profileScan;            // Duration of scans
+Profile       profileSweep;           // Full band sweeps of graphicScanner
+unsigned long profileLoopStart = 0;   // Start of the current loop pass
+unsigned int  eepromSaves = 0;        // Calls of writeEeprom
+unsigned long tuneBase = 0;           // Receiver tunes at the last reset
+unsigned long osdCounters[COUNTERS_COUNT];     // From the last counters frame
+unsigned long osdCountersBase[COUNTERS_COUNT]; // Counters at the last reset
 
 //******************************************************************************
 //* function: setup
 //******************************************************************************
 void setup()
 {
-  unsigned int i;
-
   // initialize LED pin
   pinMode(LED_PIN, OUTPUT);
   digitalWrite(LED_PIN, LED_ON);
@@ -227,11 +498,25 @@ void setup()
     currentChannel = CHANNEL_MIN;
     resetOptions();
   }
+  readCalibration();
   // Start receiver
+  receiver.begin();
+  measureNoiseFloor();
   receiver.setFrequency(getFrequency(currentChannel));
 
   // Initialize the display
-  Serial.begin(57600);
+  Serial.begin(OSD_BAUD_RATE);
+
+  // Upload screen templates if the MinimOSD does not have the current set.
+  // A MinimOSD with a status channel is checked again in the main loop.
+  templateHash = templateImage(false);
+  if (templateHash != (EEPROM.read(EEPROM_TEMPLATE_HASH) | (EEPROM.read(EEPROM_TEMPLATE_HASH + 1) << 8))) {
+    waitForOsd( MINIMOSD_BOOT_TIME_MS );
+    if (!osdBufferSize || (osdTemplateHash != templateHash))
+      uploadTemplates();
+    else
+      storeTemplateHash( templateHash );
+  }
 
   // Set Options
   if (digitalRead(BUTTON_PIN) == BUTTON_PRESSED ) {
@@ -243,6 +528,8 @@ void setup()
       long redrawTimer = 0;
       long stopTimer = millis() + 7000;
       while (( millis() < stopTimer ) && (digitalRead(BUTTON_PIN) != BUTTON_PRESSED )) {
+        osd_poll();
+        updateTemplates();
         if ( millis() > redrawTimer) {
           redrawTimer = millis() + 500;
           drawStartScreen();
@@ -250,6 +537,9 @@ void setup()
       }
     }
   }
+  if (BENCHMARKS)
+    runBenchmarks();
+  osd( CMD_SET_LOS_MODE, options[LOS_WARNING_OPTION] );
   osd( CMD_CLEAR_SCREEN );
 
   // Set delay time before entering screen save mode
@@ -261,6 +551,16 @@ void setup()
 //******************************************************************************
 void loop()
 {
+  unsigned long now = micros();
+
+  if (profileLoopStart)
+    addSample( profileLoop, now - profileLoopStart );
+  profileLoopStart = now;
+
+  // Read status frames from the MinimOSD
+  osd_poll();
+  updateTemplates();
+
   switch (lastClick = getClickType( BUTTON_PIN ))
   {
     case NO_CLICK: // do nothing
@@ -285,11 +585,21 @@ void loop()
           osd( CMD_CLEAR_SCREEN );
           setOptions();
           writeEeprom();
+          osd( CMD_SET_LOS_MODE, options[LOS_WARNING_OPTION] );
+          break;
+        case 4:
+          osd( CMD_CLEAR_SCREEN );
+          survey();
           break;
       }
       screenCleaning = 1;
       break;
 
+    case VERY_LONG_CLICK: // hidden debug page
+      showDebugScreen();
+      screenCleaning = 1;
+      break;
+
     case SINGLE_CLICK: // up the frequency
       currentChannel = nextChannel( currentChannel );
       receiver.setFrequency(getFrequency(currentChannel));
@@ -320,16 +630,17 @@ void loop()
     displayUpdateTimer = millis() + 1000;
     if ( options[INFO_LINE_OPTION] || (forceDisplayTimer > millis()))
     {
-      if (options[INFO_LINE_POS_OPTION])
-        drawLeftInfoLine();
-      else
-        drawRightInfoLine();
+      drawInfoLine();
     }
     else
     {
       osd(CMD_CLEAR_SCREEN);
       saveScreenActive = 1;
+      signalRssi = averageAnalogRead(RSSI_PIN);
     }
+    // The watchdog uses the RSSI sample of the info line
+    if ( options[REACQUIRE_OPTION] )
+      watchSignal();
   }
 
   // Check if EEPROM needs a save. Reduce EEPROM writes by not saving too often
@@ -371,6 +682,7 @@ void loop()
 //******************************************************************************
 void writeEeprom(void) {
   unsigned char i;
+  eepromSaves++;
   EEPROM.write(EEPROM_CHANNEL, currentChannel);
   for (i = 0; i < MAX_OPTIONS; i++)
     EEPROM.write(EEPROM_OPTIONS + i, options[i]);
@@ -414,6 +726,8 @@ void buttonPressInterrupt() {
         clickStart = 0;
         saveScreenActive = 0;
       }
+      else if (( millis() - clickStart) > VERY_LONG_CLICK_MS )
+        clickType = VERY_LONG_CLICK;
       else if (( millis() - clickStart) > 350 )
         clickType = LONG_CLICK;
       else
@@ -429,8 +743,9 @@ void buttonPressInterrupt() {
 //******************************************************************************
 uint8_t getClickType(uint8_t buttonPin) {
   uint8_t tempClickType = NO_CLICK;
+  unsigned long now = millis();
 
-  if (pauseStart && (millis() - pauseStart) < 350)
+  if (pauseStart && (now - pauseStart) < 350)
     return NO_CLICK;
 
   pauseStart = 0;
@@ -442,6 +757,18 @@ uint8_t getClickType(uint8_t buttonPin) {
   return tempClickType;
 }
 
+//******************************************************************************
+//* function: getMenuClickType
+//*         : getClickType for the menus and scanners. The debug page is only
+//*         : opened from the main screen, elsewhere a VERY_LONG_CLICK is a
+//*         : LONG_CLICK.
+//******************************************************************************
+uint8_t getMenuClickType(uint8_t buttonPin) {
+  uint8_t click = getClickType( buttonPin );
+
+  return (click == VERY_LONG_CLICK) ? LONG_CLICK : click;
+}
+
 //******************************************************************************
 //* function: nextChannel
 //******************************************************************************
@@ -507,21 +834,28 @@ unsigned char bestChannelMatch( unsigned int frequency )
 
 //******************************************************************************
 //* function: graphicScanner
-//*         : scans the 5.8 GHz band and draws a graphical representation.
-//*         : when the button is pressed the current frequency is returned.
+//*         : scans the 5.8 GHz band and draws the peak of the last sweeps.
+//*         : when the button is pressed the scan stops and a cursor is shown
+//*         : on the hottest frequency. Single and double clicks move the
+//*         : cursor to the next and previous hot frequency. A long click
+//*         : zooms in on the cursor to pick the frequency, see zoomScanner,
+//*         : and a very long click tunes to the cursor frequency as it is.
 //******************************************************************************
 unsigned int graphicScanner( unsigned int frequency ) {
   unsigned char i;
+  unsigned char bin;
+  unsigned char cursor;
+  unsigned char peaks[HISTORY_BINS];
   unsigned int scanRssi;
-  unsigned int bestRssi = 0;
   unsigned int scanFrequency = frequency;
-  unsigned int bestFrequency = frequency;
   unsigned char clickType;
-  unsigned char rssiDisplayValue1;
-  unsigned char rssiDisplayValue2;
+  unsigned char position;
+  unsigned long scanStart = micros();
+  unsigned long sweepStart = 0;
 
   // Draw screen frame etc
   drawScannerScreen();
+  memset( scanHistory, 0, sizeof(scanHistory) );
 
   // Disable video
   osd(CMD_DISABLE_VIDEO);
@@ -530,35 +864,198 @@ unsigned int graphicScanner( unsigned int frequency ) {
   while (digitalRead(BUTTON_PIN) != BUTTON_PRESSED) {
     for (i = 0; i < 2; i++) {
       scanFrequency += SCANNING_STEP;
-      if (scanFrequency > FREQUENCY_MAX)
+      if (scanFrequency > FREQUENCY_MAX) {
         scanFrequency = FREQUENCY_MIN;
+        // The first sweep starts mid band and is not timed
+        if (sweepStart)
+          addSample( profileSweep, micros() - sweepStart );
+        sweepStart = micros();
+        // Start a new sweep, dropping the oldest one
+        historySweep = (historySweep + 1) % HISTORY_SWEEPS;
+        for (bin = 0; bin < HISTORY_BINS; bin++)
+          setHistoryLevel( historySweep, bin, 0 );
+      }
       receiver.setFrequency(scanFrequency);
       delay( RSSI_STABILITY_DELAY_MS );
       scanRssi = averageAnalogRead(RSSI_PIN);
-      if (!i)
-        rssiDisplayValue1 = (scanRssi - 140) / 20;    // Roughly 1 - 23
-      else
-        rssiDisplayValue2 = (scanRssi - 140) / 20;    // Roughly 1 - 23
+      trackRssi( scanFrequency, scanRssi );
+      // The lowest frequency is left of the first column
+      if (scanFrequency > FREQUENCY_MIN)
+        setHistoryLevel( historySweep, HISTORY_BINS - 1 - (FREQUENCY_MAX - scanFrequency) / SCANNING_STEP,
+                         rssiLevel( scanFrequency, scanRssi, SCANNER_ROWS ) );
     }
-    updateScannerScreen(29 - ((FREQUENCY_MAX - scanFrequency) / FREQUENCY_DIVIDER), rssiDisplayValue1, rssiDisplayValue2 );
+    position = 29 - ((FREQUENCY_MAX - scanFrequency) / FREQUENCY_DIVIDER);
+    if (position < 30)
+      updateScannerScreen(position, peakLevel(position * 2) * 2, peakLevel(position * 2 + 1) * 2 );
   }
-  // Fine tuning
-  scanFrequency = scanFrequency - SCANNING_STEP*4;
-  for (i = 0; i < SCANNING_STEP*4; i++, scanFrequency += 2) {
-    receiver.setFrequency(scanFrequency);
-    delay( RSSI_STABILITY_DELAY_MS );
-    scanRssi = averageAnalogRead(RSSI_PIN);
-    if (bestRssi < scanRssi) {
-      bestRssi = scanRssi;
-      bestFrequency = scanFrequency;
+  // Skip the click that stopped the scan
+  while (getClickType( BUTTON_PIN ) == NO_CLICK)
+    ;
+
+  // Move the cursor between hot frequencies
+  for (bin = 0; bin < HISTORY_BINS; bin++)
+    peaks[bin] = peakLevel( bin );
+  cursor = 0;
+  for (bin = 0; bin < HISTORY_BINS; bin++)
+    if (peaks[bin] > peaks[cursor])
+      cursor = bin;
+  drawScannerCursor( cursor / 2, FREQUENCY_MAX - (HISTORY_BINS - 1 - cursor) * SCANNING_STEP );
+  while (((clickType = getClickType( BUTTON_PIN )) != LONG_CLICK) && (clickType != VERY_LONG_CLICK)) {
+    if (clickType == SINGLE_CLICK || clickType == DOUBLE_CLICK) {
+      cursor = hotIndex( peaks, HISTORY_BINS, cursor, clickType == SINGLE_CLICK, HISTORY_HOT_LEVEL );
+      drawScannerCursor( cursor / 2, FREQUENCY_MAX - (HISTORY_BINS - 1 - cursor) * SCANNING_STEP );
+    }
+  }
+  addSample( profileScan, micros() - scanStart );
+  frequency = FREQUENCY_MAX - (HISTORY_BINS - 1 - cursor) * SCANNING_STEP;
+
+  // Take the cursor frequency as it is
+  if (clickType == VERY_LONG_CLICK) {
+    osd(CMD_ENABLE_VIDEO);
+    saveCalibration();
+    receiver.setFrequency( frequency );
+    return frequency;
+  }
+  // Zoom in on the cursor to pick the frequency
+  return zoomScanner( frequency );
+}
+
+//******************************************************************************
+//* function: zoomScanner
+//*         : scans the OSD_COLUMNS * ZOOM_STEP MHz around a frequency over
+//*         : and over until the button is pressed. Each pass is measured
+//*         : first and then drawn row by row, which keeps a pass well under
+//*         : a second. The cursor works as in graphicScanner, but a long
+//*         : click tunes to the cursor frequency and returns it.
+//******************************************************************************
+unsigned int zoomScanner( unsigned int frequency ) {
+  unsigned char levels[OSD_COLUMNS];
+  unsigned char i;
+  unsigned char row;
+  unsigned char cursor;
+  unsigned char clickType;
+  unsigned int scanRssi;
+  unsigned int firstFrequency;
+
+  // Center the frequency, staying inside the band on odd frequencies
+  firstFrequency = frequency - (OSD_COLUMNS / 2) * ZOOM_STEP;
+  if (frequency < FREQUENCY_MIN + (OSD_COLUMNS / 2) * ZOOM_STEP)
+    firstFrequency = FREQUENCY_MIN;
+  if (firstFrequency > FREQUENCY_MAX - (OSD_COLUMNS - 1) * ZOOM_STEP)
+    firstFrequency = FREQUENCY_MAX - (OSD_COLUMNS - 1) * ZOOM_STEP;
+  firstFrequency |= 1;        // RTC6715 can only generate odd frequencies
+
+  // Zoom labels at both ends, the middle is left to the cursor frequency
+  // of drawScannerCursor
+  osdScreen = TRAFFIC_SCANNER;
+  osd( CMD_SET_X, 0 );
+  osd( CMD_SET_Y, scannerBarLine + 1 );
+  osd_string( "                              " );
+  for (i = 0; i < OSD_COLUMNS; i += OSD_COLUMNS - 6) {
+    osd( CMD_SET_X, i + 1 );
+    osd( CMD_SET_Y, scannerBarLine + 1 );
+    osd_int( firstFrequency + i * ZOOM_STEP );
+  }
+
+  do {
+    for (i = 0; i < OSD_COLUMNS; i++) {
+      receiver.setFrequency( firstFrequency + i * ZOOM_STEP );
+      delay( i ? ZOOM_STABILITY_DELAY_MS : RSSI_STABILITY_DELAY_MS );
+      scanRssi = averageAnalogRead(RSSI_PIN);
+      levels[i] = rssiLevel( firstFrequency + i * ZOOM_STEP, scanRssi, SCANNER_ROWS * 2 );
+    }
+    // Draw the bars, the bottom line is the scanner bar template
+    for (row = 0; row < SCANNER_ROWS; row++) {
+      osd( CMD_SET_X, 0 );
+      osd( CMD_SET_Y, scannerBarLine - row );
+      for (i = 0; i < OSD_COLUMNS; i++)
+        osd_char( barGlyph( levels[i], levels[i], row ) );
+    }
+  } while (digitalRead(BUTTON_PIN) != BUTTON_PRESSED);
+  // Skip the click that stopped the scan
+  while (getClickType( BUTTON_PIN ) == NO_CLICK)
+    ;
+
+  cursor = 0;
+  for (i = 0; i < OSD_COLUMNS; i++)
+    if (levels[i] > levels[cursor])
+      cursor = i;
+  drawScannerCursor( cursor, firstFrequency + cursor * ZOOM_STEP );
+  while ((clickType = getMenuClickType( BUTTON_PIN )) != LONG_CLICK) {
+    if (clickType == SINGLE_CLICK || clickType == DOUBLE_CLICK) {
+      cursor = hotIndex( levels, OSD_COLUMNS, cursor, clickType == SINGLE_CLICK, ZOOM_HOT_LEVEL );
+      drawScannerCursor( cursor, firstFrequency + cursor * ZOOM_STEP );
     }
   }
   // Enable Video
   osd(CMD_ENABLE_VIDEO);
 
-  // Return the best frequency
-  receiver.setFrequency(bestFrequency);
-  return (bestFrequency);
+  saveCalibration();
+
+  frequency = firstFrequency + cursor * ZOOM_STEP;
+  receiver.setFrequency( frequency );
+  return frequency;
+}
+
+//******************************************************************************
+//* function: historyLevel
+//*         : returns the 4-bit level of a bin in one of the stored sweeps
+//******************************************************************************
+unsigned char historyLevel( unsigned char sweep, unsigned char bin ) {
+  unsigned char data = scanHistory[sweep * (HISTORY_BINS / 2) + bin / 2];
+  return (bin & 1) ? data >> 4 : data & 0x0F;
+}
+
+//******************************************************************************
+//* function: setHistoryLevel
+//*         : stores the level of a bin in one of the sweeps, max 15
+//******************************************************************************
+void setHistoryLevel( unsigned char sweep, unsigned char bin, unsigned char level ) {
+  unsigned char *data = &scanHistory[sweep * (HISTORY_BINS / 2) + bin / 2];
+  if (level > 15)
+    level = 15;
+  if (bin & 1)
+    *data = (*data & 0x0F) | (level << 4);
+  else
+    *data = (*data & 0xF0) | level;
+}
+
+//******************************************************************************
+//* function: peakLevel
+//*         : returns the highest level of a bin in the stored sweeps.
+//*         : Peaks decay as the sweeps holding them are dropped.
+//******************************************************************************
+unsigned char peakLevel( unsigned char bin ) {
+  unsigned char sweep;
+  unsigned char level;
+  unsigned char peak = 0;
+
+  for (sweep = 0; sweep < HISTORY_SWEEPS; sweep++) {
+    level = historyLevel( sweep, bin );
+    if (level > peak)
+      peak = level;
+  }
+  return peak;
+}
+
+//******************************************************************************
+//* function: hotIndex
+//*         : returns the next hot index after index in the given direction,
+//*         : wrapping around. A hot index is a local peak of at least hot.
+//*         : Returns the neighbour index if none is hot.
+//******************************************************************************
+unsigned char hotIndex( const unsigned char *levels, unsigned char count, unsigned char index, bool forward, unsigned char hot ) {
+  unsigned char i;
+  unsigned char candidate = index;
+
+  for (i = 0; i < count; i++) {
+    candidate = forward ? (candidate + 1) % count : (candidate + count - 1) % count;
+    if ((levels[candidate] >= hot) &&
+        (candidate == 0 || levels[candidate] > levels[candidate - 1]) &&
+        (candidate == count - 1 || levels[candidate] >= levels[candidate + 1]))
+      return candidate;
+  }
+  return forward ? (index + 1) % count : (index + count - 1) % count;
 }
 
 //******************************************************************************
@@ -566,10 +1063,12 @@ unsigned int graphicScanner( unsigned int frequency ) {
 //******************************************************************************
 unsigned int autoScan( unsigned int frequency ) {
   unsigned char i;
+  bool found = false;
   unsigned int scanRssi = 0;
   unsigned int bestRssi = 0;
   unsigned int scanFrequency;
   unsigned int bestFrequency;
+  unsigned long scanStart = micros();
 
   // Disable video
   osd(CMD_DISABLE_VIDEO);
@@ -579,9 +1078,9 @@ unsigned int autoScan( unsigned int frequency ) {
   if (!(scanFrequency % 2))
     scanFrequency++;        // RTC6715 can only generate odd frequencies
 
-  // Coarse tuning
+  // Coarse tuning, stop at the first signal well above the noise floor
   bestFrequency = scanFrequency;
-  for (i = 0; i < 60 && (scanRssi < RSSI_TRESHOLD); i++) {
+  for (i = 0; i < 60 && !found; i++) {
     if ( scanFrequency <= (FREQUENCY_MAX - SCANNING_STEP))
       scanFrequency += SCANNING_STEP;
     else
@@ -589,6 +1088,8 @@ unsigned int autoScan( unsigned int frequency ) {
     receiver.setFrequency(scanFrequency);
     delay( RSSI_STABILITY_DELAY_MS );
     scanRssi = averageAnalogRead(RSSI_PIN);
+    found = (scanRssi >= rssiThreshold( scanFrequency ));
+    trackRssi( scanFrequency, scanRssi );
     if (bestRssi < scanRssi) {
       bestRssi = scanRssi;
       bestFrequency = scanFrequency;
@@ -608,11 +1109,303 @@ unsigned int autoScan( unsigned int frequency ) {
   }
   // Enable Video
   osd(CMD_ENABLE_VIDEO);
+  addSample( profileScan, micros() - scanStart );
+  saveCalibration();
 
   // Return the best frequency
   receiver.setFrequency(bestFrequency);
   return (bestFrequency);
 }
+
+//******************************************************************************
+//* function: readCalibration
+//*         : reads the calibrated RSSI range from EEPROM and starts the
+//*         : noise floor estimates at the low end of the range
+//******************************************************************************
+void readCalibration( void )
+{
+  unsigned char i;
+
+  rssiMin = EEPROM.read(EEPROM_RSSI_MIN) | (EEPROM.read(EEPROM_RSSI_MIN + 1) << 8);
+  rssiMax = EEPROM.read(EEPROM_RSSI_MAX) | (EEPROM.read(EEPROM_RSSI_MAX + 1) << 8);
+  if ((rssiMin > 1023) || (rssiMax > 1023) || (rssiMin >= rssiMax)) {
+    rssiMin = RSSI_MIN_DEFAULT;
+    rssiMax = RSSI_MAX_DEFAULT;
+  }
+  calibrationChanged = false;
+  for (i = 0; i < NOISE_SEGMENTS; i++)
+    noiseFloor[i] = rssiMin;
+}
+
+//******************************************************************************
+//* function: saveCalibration
+//*         : writes the RSSI range to EEPROM if it has changed. It is only
+//*         : saved after a scan, so the number of writes stays small.
+//******************************************************************************
+void saveCalibration( void )
+{
+  if (!calibrationChanged)
+    return;
+  EEPROM.write(EEPROM_RSSI_MIN, rssiMin & 0xFF);
+  EEPROM.write(EEPROM_RSSI_MIN + 1, rssiMin >> 8);
+  EEPROM.write(EEPROM_RSSI_MAX, rssiMax & 0xFF);
+  EEPROM.write(EEPROM_RSSI_MAX + 1, rssiMax >> 8);
+  calibrationChanged = false;
+}
+
+//******************************************************************************
+//* function: measureNoiseFloor
+//*         : sets the noise floor of each segment of the band to the lowest
+//*         : of NOISE_SAMPLES samples spread over the segment, so a sample
+//*         : that hits a signal is ignored. It is only done at start, the
+//*         : scans keep the floors up to date. The lowest floor becomes the
+//*         : low end of the calibrated range and the high end decays towards it.
+//******************************************************************************
+void measureNoiseFloor( void )
+{
+  unsigned int rssi;
+  unsigned int lowest = 1023;
+  unsigned int range;
+  unsigned char segment;
+  unsigned char i;
+
+  for (segment = noiseSegment( FREQUENCY_MIN ); segment < NOISE_SEGMENTS; segment++) {
+    noiseFloor[segment] = 1023;
+    for (i = 0; i < NOISE_SAMPLES; i++) {
+      // RTC6715 can only generate odd frequencies
+      receiver.setFrequency( (NOISE_SEGMENT_MIN + segment * NOISE_SEGMENT_MHZ + i * (NOISE_SEGMENT_MHZ / NOISE_SAMPLES)) | 1 );
+      delay( RSSI_STABILITY_DELAY_MS );
+      rssi = averageAnalogRead(RSSI_PIN);
+      if (rssi < noiseFloor[segment])
+        noiseFloor[segment] = rssi;
+    }
+    if (noiseFloor[segment] < lowest)
+      lowest = noiseFloor[segment];
+  }
+
+  range = (rssiMax > lowest + RSSI_RANGE_MIN) ? rssiMax - lowest : RSSI_RANGE_MIN;
+  range -= (range - RSSI_RANGE_MIN) / RSSI_RANGE_DECAY;
+  if ((rssiMin != lowest) || (rssiMax != lowest + range)) {
+    rssiMin = lowest;
+    rssiMax = lowest + range;
+    calibrationChanged = true;
+  }
+}
+
+//******************************************************************************
+//* function: noiseSegment
+//*         : returns the noise floor segment of a frequency
+//******************************************************************************
+unsigned char noiseSegment( unsigned int frequency )
+{
+  unsigned char segment;
+
+  if (frequency < NOISE_SEGMENT_MIN)
+    return 0;
+  segment = (frequency - NOISE_SEGMENT_MIN) / NOISE_SEGMENT_MHZ;
+  return segment < NOISE_SEGMENTS ? segment : NOISE_SEGMENTS - 1;
+}
+
+//******************************************************************************
+//* function: trackRssi
+//*         : adds a scan sample to the RSSI range and the noise floor.
+//*         : The floor follows lower samples quickly and higher samples
+//*         : slowly, so signals only raise it a little.
+//******************************************************************************
+void trackRssi( unsigned int frequency, unsigned int rssi )
+{
+  unsigned int *noise = &noiseFloor[noiseSegment( frequency )];
+
+  if (rssi < rssiMin) {
+    rssiMin = rssi;
+    calibrationChanged = true;
+  }
+  if (rssi > rssiMax) {
+    rssiMax = rssi;
+    calibrationChanged = true;
+  }
+  if (rssi < *noise)
+    *noise -= (*noise - rssi + 1) / 2;
+  else if (rssi > *noise)
+    *noise += ((rssi - *noise) >> 2) + 1;
+}
+
+//******************************************************************************
+//* function: rssiThreshold
+//*         : returns the RSSI a signal needs at a frequency, which is
+//*         : RSSI_SNR_PERCENT of the calibrated range above the noise floor
+//******************************************************************************
+unsigned int rssiThreshold( unsigned int frequency )
+{
+  return noiseFloor[noiseSegment( frequency )] + (unsigned long)(rssiMax - rssiMin) * RSSI_SNR_PERCENT / 100;
+}
+
+//******************************************************************************
+//* function: rssiLevel
+//*         : scales an RSSI to the levels 0 to top, from the noise floor of
+//*         : the frequency to the calibrated maximum
+//******************************************************************************
+unsigned char rssiLevel( unsigned int frequency, unsigned int rssi, unsigned char top )
+{
+  unsigned int noise = noiseFloor[noiseSegment( frequency )];
+
+  if ((rssi <= noise) || (rssiMax <= noise))
+    return 0;
+  if (rssi >= rssiMax)
+    return top;
+  return (unsigned long)(rssi - noise) * top / (rssiMax - noise);
+}
+
+//******************************************************************************
+//* function: watchSignal
+//*         : signal loss watchdog, called with every info line sample.
+//*         : The RSSI of the signal is learned as a running average of all
+//*         : samples, so a signal that fades slowly takes the threshold down
+//*         : with it. When the RSSI stays below halfway between the noise
+//*         : floor and the learned RSSI, and below the signal threshold of
+//*         : rssiThreshold, for REACQUIRE_DELAY_MS, the frequencies around
+//*         : the last good frequency are swept.
+//******************************************************************************
+void watchSignal( void )
+{
+  unsigned int noise = noiseFloor[noiseSegment( goodFrequency )];
+  unsigned int threshold = noise + (goodRssi > noise ? (goodRssi - noise) / 2 : 0);
+  unsigned int frequency;
+
+  // Only a drop close to the noise floor is a lost signal
+  if (threshold > rssiThreshold( goodFrequency ))
+    threshold = rssiThreshold( goodFrequency );
+
+  // Start over when the user has changed channel
+  if (abs((int)receiver.getFrequency() - (int)goodFrequency) > REACQUIRE_WINDOW_MHZ) {
+    goodRssi = signalRssi;
+    goodFrequency = receiver.getFrequency();
+    signalLostTime = 0;
+    return;
+  }
+  goodRssi = goodRssi - (goodRssi >> 3) + (signalRssi >> 3);
+  if (signalRssi >= threshold) {
+    goodFrequency = receiver.getFrequency();
+    signalLostTime = 0;
+  }
+  else if (!signalLostTime)
+    signalLostTime = millis();
+  else if (millis() - signalLostTime >= REACQUIRE_DELAY_MS) {
+    frequency = reacquireSignal( goodFrequency, threshold );
+    if (frequency) {
+      currentChannel = bestChannelMatch( frequency );
+      goodFrequency = frequency;
+      signalLostTime = 0;
+    }
+    else
+      signalLostTime = millis();   // Try again later
+  }
+}
+
+//******************************************************************************
+//* function: reacquireSignal
+//*         : sweeps REACQUIRE_WINDOW_MHZ around a frequency in ZOOM_STEP
+//*         : steps, inside the band, and tunes to the strongest frequency
+//*         : above threshold. Returns the frequency, or 0 with the receiver
+//*         : back on the given frequency if nothing was found. Takes about
+//*         : 150 ms.
+//******************************************************************************
+unsigned int reacquireSignal( unsigned int frequency, unsigned int threshold )
+{
+  unsigned int scanFrequency = frequency - REACQUIRE_WINDOW_MHZ;
+  unsigned int lastFrequency = frequency + REACQUIRE_WINDOW_MHZ;
+  unsigned int scanRssi;
+  unsigned int bestRssi = 0;
+  unsigned int bestFrequency = frequency;
+
+  if (scanFrequency < FREQUENCY_MIN)
+    scanFrequency = FREQUENCY_MIN;
+  if (lastFrequency > FREQUENCY_MAX)
+    lastFrequency = FREQUENCY_MAX;
+  scanFrequency |= 1;         // RTC6715 can only generate odd frequencies
+
+  for ( ; scanFrequency <= lastFrequency; scanFrequency += ZOOM_STEP) {
+    receiver.setFrequency( scanFrequency );
+    delay( ZOOM_STABILITY_DELAY_MS );
+    scanRssi = averageAnalogRead(RSSI_PIN);
+    if (bestRssi < scanRssi) {
+      bestRssi = scanRssi;
+      bestFrequency = scanFrequency;
+    }
+  }
+  receiver.setFrequency( bestRssi >= threshold ? bestFrequency : frequency );
+  return bestRssi >= threshold ? bestFrequency : 0;
+}
+
+//******************************************************************************
+//* function: survey
+//*         : sweeps the band over and over until the button is pressed.
+//*         : Each sweep and a sample of the tuned frequency are sent as
+//*         : survey frames. The number of sweeps is shown on screen.
+//******************************************************************************
+void survey( void )
+{
+  unsigned char frame[SURVEY_SWEEP_HEADER + SURVEY_MAX_BINS];
+  unsigned int tunedFrequency = receiver.getFrequency();
+  unsigned int frequency;
+  unsigned int sweeps = 0;
+  unsigned int rssi;
+  unsigned long sweepStart;
+  unsigned char bins;
+
+  osdScreen = TRAFFIC_OTHER;
+  osd( CMD_SET_X, 1 );
+  osd( CMD_SET_Y, 1 );
+  osd_string( "survey sweeps" );
+
+  // Disable video
+  osd(CMD_DISABLE_VIDEO);
+
+  while (digitalRead(BUTTON_PIN) != BUTTON_PRESSED) {
+    sweepStart = millis();
+    bins = 0;
+    for (frequency = FREQUENCY_MIN; (frequency <= FREQUENCY_MAX) && (bins < SURVEY_MAX_BINS); frequency += SCANNING_STEP) {
+      receiver.setFrequency(frequency);
+      delay( RSSI_STABILITY_DELAY_MS );
+      rssi = averageAnalogRead(RSSI_PIN);
+      trackRssi( frequency, rssi );
+      frame[SURVEY_SWEEP_HEADER + bins++] = rssi >> 2;
+    }
+    frame[0] = SURVEY_SWEEP;
+    storeLittleEndian( frame + 1, sweepStart, 4 );
+    storeLittleEndian( frame + 5, FREQUENCY_MIN, 2 );
+    frame[7] = SCANNING_STEP;
+    frame[8] = bins;
+    osd_survey( frame, SURVEY_SWEEP_HEADER + bins );
+
+    receiver.setFrequency(tunedFrequency);
+    delay( RSSI_STABILITY_DELAY_MS );
+    frame[0] = SURVEY_SAMPLE;
+    storeLittleEndian( frame + 1, millis(), 4 );
+    storeLittleEndian( frame + 5, tunedFrequency, 2 );
+    storeLittleEndian( frame + 7, averageAnalogRead(RSSI_PIN), 2 );
+    storeLittleEndian( frame + 9, getVoltage(), 2 );
+    osd_survey( frame, SURVEY_SAMPLE_SIZE );
+
+    osd( CMD_SET_X, 15 );
+    osd( CMD_SET_Y, 1 );
+    osd_int( ++sweeps );
+  }
+  // Enable Video
+  osd(CMD_ENABLE_VIDEO);
+  saveCalibration();
+}
+
+//******************************************************************************
+//* function: storeLittleEndian
+//*         : stores the size low bytes of a value, low byte first
+//******************************************************************************
+void storeLittleEndian( unsigned char *data, unsigned long value, unsigned char size )
+{
+  for ( ; size; size--, value >>= 8)
+    *data++ = value & 0xFF;
+}
+
 //******************************************************************************
 //* function: averageAnalogRead
 //*         : used to read from an anlog pin
@@ -623,34 +1416,160 @@ unsigned int averageAnalogRead( unsigned char pin)
 {
   unsigned int rssi = 0;
   unsigned char i = 32;
+  unsigned long start = micros();
 
   for ( ; i ; i--) {
     rssi += analogRead(pin);
   }
+  addSample( profileAdc, micros() - start );
   return (rssi >> 5);
 }
 
 //******************************************************************************
-//* function: shortNameOfChannel
+//* function: addSample
+//*         : adds a time to a profiling counter
 //******************************************************************************
-char *shortNameOfChannel(unsigned char channel, char *name)
+void addSample( Profile &profile, unsigned long time )
 {
-  unsigned char channelIndex = getPosition(channel);
-  if (channelIndex < 8)
-    name[0] = 'a';
-  else if (channelIndex < 16)
-    name[0] = 'b';
-  else if (channelIndex < 24)
-    name[0] = 'e';
-  else if (channelIndex < 32)
-    name[0] = 'f';
-  else if (channelIndex < 40)
-    name[0] = 'c';
-  else
-    name[0] = 'l';
-  name[1] = (channelIndex % 8) + '0' + 1;
-  name[2] = 0;
-  return name;
+  if (!profile.count || (time < profile.min))
+    profile.min = time;
+  if (time > profile.max)
+    profile.max = time;
+  profile.total += time;
+  profile.count++;
+}
+
+//******************************************************************************
+//* function: averageSample
+//******************************************************************************
+unsigned long averageSample( const Profile &profile )
+{
+  return profile.count ? profile.total / profile.count : 0;
+}
+
+//******************************************************************************
+//* function: resetProfiling
+//*         : starts all profiling counters over. The MinimOSD counters can
+//*         : not be reset, their current values are remembered instead.
+//******************************************************************************
+void resetProfiling( void )
+{
+  memset( &profileLoop, 0, sizeof(profileLoop) );
+  memset( &profileOsdWait, 0, sizeof(profileOsdWait) );
+  memset( &profileAdc, 0, sizeof(profileAdc) );
+  memset( &profileScan, 0, sizeof(profileScan) );
+  memset( &profileSweep, 0, sizeof(profileSweep) );
+  memset( osdTraffic, 0, sizeof(osdTraffic) );
+  profileLoopStart = 0;
+  eepromSaves = 0;
+  tuneBase = receiver.getTuneCount();
+  memcpy( osdCountersBase, osdCounters, sizeof(osdCountersBase) );
+}
+
+//******************************************************************************
+//* function: showDebugScreen
+//*         : shows the profiling counters until the button is clicked.
+//*         : The counters are reset when the page is left.
+//******************************************************************************
+void showDebugScreen( void )
+{
+  unsigned long redrawTimer = 0;
+
+  while (getClickType( BUTTON_PIN ) == NO_CLICK) {
+    osd_poll();
+    if (millis() > redrawTimer) {
+      redrawTimer = millis() + 1000;
+      osd( CMD_SEND_COUNTERS );
+      drawDebugScreen();
+    }
+  }
+  resetProfiling();
+}
+
+//******************************************************************************
+//* function: runBenchmarks
+//*         : times the hot functions with micros() and shows the results
+//*         : until the button is pressed. Each result is a "name time" line,
+//*         : where time is in microseconds per call. The lines are ended
+//*         : with CMD_NEWLINE, so the results can be logged by tapping the
+//*         : CYCLOP++ TX line. Enabled with BENCHMARKS in cyclop_plus_plus.h
+//*         : The OSD traffic of the run follows as "screen bytes commands
+//*         : redundant-moves wire-ms" lines.
+//******************************************************************************
+void runBenchmarks( void )
+{
+  const char * const names[] = { "loop", "setfrequency", "analogread",
+                                 "scannerupdate", "optionsscreen", "infoline" };
+  const char * const screens[TRAFFIC_SCREENS] = { "other", "infoline", "start",
+                                                  "scanner", "options" };
+  unsigned long times[sizeof(names) / sizeof(names[0])];
+  OsdTraffic traffic[TRAFFIC_SCREENS];
+  unsigned long start;
+  unsigned char i;
+
+  osd( CMD_CLEAR_SCREEN );
+  osd_flush();
+  memset( osdTraffic, 0, sizeof(osdTraffic) );
+
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    loop();
+  times[0] = micros() - start;
+
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    receiver.setFrequency( (i & 1) ? FREQUENCY_MIN : FREQUENCY_MAX );
+  times[1] = micros() - start;
+
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    averageAnalogRead( RSSI_PIN );
+  times[2] = micros() - start;
+
+  // Drawing is timed until the MinimOSD has consumed all bytes
+  drawScannerScreen();
+  osd_flush();
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    updateScannerScreen( i, i & 15, 15 - (i & 15) );
+  osd_flush();
+  times[3] = micros() - start;
+
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    drawOptionsScreen( i % (MAX_OPTIONS + MAX_COMMANDS), 0 );
+  osd_flush();
+  times[4] = micros() - start;
+
+  start = micros();
+  for (i = 0; i < BENCHMARK_CALLS; i++)
+    drawInfoLine();
+  osd_flush();
+  times[5] = micros() - start;
+
+  receiver.setFrequency( getFrequency(currentChannel) );
+  memcpy( traffic, osdTraffic, sizeof(traffic) );
+  osd( CMD_CLEAR_SCREEN );
+  for (i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    osd_string( names[i] );
+    osd_char( ' ' );
+    osd_long( times[i] / BENCHMARK_CALLS );
+    osd( CMD_NEWLINE );
+  }
+  for (i = 0; i < TRAFFIC_SCREENS; i++) {
+    osd_string( screens[i] );
+    osd_char( ' ' );
+    osd_long( traffic[i].bytes );
+    osd_char( ' ' );
+    osd_int( traffic[i].commands );
+    osd_char( ' ' );
+    osd_int( traffic[i].redundantMoves );
+    osd_char( ' ' );
+    osd_long( traffic[i].bytes * 10000 / OSD_BAUD_RATE );  // 10 bits per byte
+    osd( CMD_NEWLINE );
+  }
+  while (digitalRead(BUTTON_PIN) != BUTTON_PRESSED)
+    osd_poll();
 }
 
 //******************************************************************************
@@ -710,9 +1629,11 @@ inline uint8_t GetRightBatteryX(uint8_t defaultX)
 }
 
 //******************************************************************************
-//* function: batteryMeter
+//* function: batteryLevel
+//*         : returns the battery level in percent (0-99) and sets the alarm
+//*         : periods accordingly
 //******************************************************************************
-void batteryMeter( unsigned char x, unsigned char y )
+unsigned char batteryLevel( void )
 {
   unsigned int voltage;
   unsigned char value;
@@ -758,7 +1679,15 @@ void batteryMeter( unsigned char x, unsigned char y )
     alarmOnPeriod = 0;
     alarmOffPeriod = 0;
   }
-  drawBattery(x, y, value, options[BATTERY_TEXT_OPTION]);
+  return value;
+}
+
+//******************************************************************************
+//* function: batteryMeter
+//******************************************************************************
+void batteryMeter( unsigned char x, unsigned char y )
+{
+  drawBattery(x, y, batteryLevel(), options[BATTERY_TEXT_OPTION]);
 }
 
 //******************************************************************************
@@ -802,6 +1731,8 @@ void updateSoftPositions( void ) {
 //*         : Resets all configuration settings to their default values
 //******************************************************************************
 void resetOptions(void) {
+  unsigned char i;
+
   options[BATTERY_ALARM_OPTION]    = BATTERY_ALARM_DEFAULT;
   options[ALARM_LEVEL_OPTION]      = ALARM_LEVEL_DEFAULT;
   options[BATTERY_TYPE_OPTION]     = BATTERY_TYPE_DEFAULT;
@@ -816,6 +1747,17 @@ void resetOptions(void) {
   options[R_BAND_OPTION]           = R_BAND_DEFAULT;
   options[L_BAND_OPTION]           = L_BAND_DEFAULT;
   options[BATTERY_TEXT_OPTION]     = BATTERY_TEXT_DEFAULT;
+  options[LOS_WARNING_OPTION]      = LOS_WARNING_DEFAULT;
+  options[REACQUIRE_OPTION]        = REACQUIRE_DEFAULT;
+
+  // Forces a new template upload on next start, e.g. after a MinimOSD swap
+  EEPROM.write(EEPROM_TEMPLATE_HASH, 0xFF);
+  EEPROM.write(EEPROM_TEMPLATE_HASH + 1, 0xFF);
+
+  // Calibrate the RSSI range again, e.g. after a receiver module swap
+  for (i = 0; i < 4; i++)
+    EEPROM.write(EEPROM_RSSI_MIN + i, 0xFF);
+  readCalibration();
 
   updateSoftPositions();
 }
@@ -832,6 +1774,7 @@ void setOptions()
   long redrawTimer = 0;
 
   // Display option screen
+  drawStartScreen();
   drawOptionsScreen( menuSelection, in_edit_state );
 
   // Let the user release the button
@@ -839,7 +1782,7 @@ void setOptions()
 
   while ( !exitNow )
   {
-    click = getClickType( BUTTON_PIN );
+    click = getMenuClickType( BUTTON_PIN );
 
     if (in_edit_state)
       switch ( click )
@@ -858,6 +1801,11 @@ void setOptions()
             if (options[BATTERY_CALIB_OPTION] < 250)
               options[BATTERY_CALIB_OPTION] += 5;
           }
+          else if (menuSelection == LOS_WARNING_OPTION)
+          {
+            if (options[LOS_WARNING_OPTION] < LOS_GRAY)
+              options[LOS_WARNING_OPTION]++;
+          }
           else
             options[menuSelection] = !options[menuSelection];
           break;
@@ -873,6 +1821,11 @@ void setOptions()
             if (options[BATTERY_CALIB_OPTION] > 5)
               options[BATTERY_CALIB_OPTION] -= 5;
           }
+          else if (menuSelection == LOS_WARNING_OPTION)
+          {
+            if (options[LOS_WARNING_OPTION] > LOS_NONE)
+              options[LOS_WARNING_OPTION]--;
+          }
           else
             options[menuSelection] = !options[menuSelection];
           break;
@@ -902,8 +1855,10 @@ void setOptions()
         case LONG_CLICK:     // Execute command or toggle option
           if (menuSelection == EXIT_COMMAND)
             exitNow = true;
-          else if (menuSelection == RESET_SETTINGS_COMMAND)
+          else if (menuSelection == RESET_SETTINGS_COMMAND) {
             resetOptions();
+            measureNoiseFloor();
+          }
           else if (menuSelection == TEST_ALARM_COMMAND) {
             testAlarm();
           }
@@ -946,24 +1901,180 @@ uint8_t selectFunction(void)
   do
   {
     drawFunctionScreen( function );
-    lastClick = getClickType( BUTTON_PIN );
+    lastClick = getMenuClickType( BUTTON_PIN );
     if (lastClick == SINGLE_CLICK)
-      function == 3 ? function = 0 : function++;
+      function == 4 ? function = 0 : function++;
     if (lastClick == DOUBLE_CLICK)
-      function == 0 ? function = 3 : function--;
+      function == 0 ? function = 4 : function--;
   }
   while ( lastClick != LONG_CLICK );
   return ( function );
 }
 
+//******************************************************************************
+//* function: osd_poll
+//*         : reads status frames from the MinimOSD
+//******************************************************************************
+void osd_poll( void )
+{
+  static unsigned char frame[COUNTERS_PARAMS + 1];  // Frame type + params
+  static unsigned char count = sizeof(frame);       // Full = wait for frame start
+  static unsigned char length = 0;                  // Length of this frame type
+  unsigned char check;
+  unsigned char i;
+  int c;
+
+  while ((c = Serial.read()) >= 0) {
+    if (c == STATUS_START) {
+      count = 0;
+      continue;
+    }
+    if (count >= sizeof(frame))
+      continue;
+    frame[count++] = c;
+    if (count == 1) {
+      if (c == STATUS_FRAME)
+        length = STATUS_PARAMS + 1;
+      else if (c == STATUS_COUNTERS)
+        length = COUNTERS_PARAMS + 1;
+      else
+        count = sizeof(frame);                      // Unknown frame type
+    }
+    else if (count == length) {
+      check = 0;
+      for (i = 0; i < length - 1; i++)
+        check ^= frame[i];
+      if (check == frame[length - 1]) {
+        if (frame[0] == STATUS_FRAME)
+          osd_status(frame + 1);
+        else
+          osd_counters(frame + 1);
+      }
+      count = sizeof(frame);
+    }
+  }
+}
+
+//******************************************************************************
+//* function: osd_status
+//*         : updates the MinimOSD state from a status frame
+//******************************************************************************
+void osd_status( const unsigned char *params )
+{
+  osdOverflows = (params[STATUS_OVERFLOWS_HI] << 7) | params[STATUS_OVERFLOWS_LO];
+  // Lost bytes will never be consumed but are no longer in flight either
+  osdConsumed = (((params[STATUS_CONSUMED_HI] << 7) | params[STATUS_CONSUMED_LO]) + osdOverflows) &
+                OSD_COUNTER_MASK;
+  osdBufferSize = params[STATUS_BUFFER_SIZE] * 8;
+  osdVideoFormat = params[STATUS_VIDEO];
+  osdTemplateHash = ((unsigned int)params[STATUS_TEMPLATE_HI] << 14) |
+                    (params[STATUS_TEMPLATE_MID] << 7) | params[STATUS_TEMPLATE_LO];
+  osdStatusTime = millis();
+
+  // A new epoch: The MinimOSD has restarted or this is the first frame. More
+  // bytes in flight than fit the buffer: The counts are out of step. Start
+  // counting from here.
+  if ((params[STATUS_EPOCH] != osdEpoch) || (((osdSent - osdConsumed) & OSD_COUNTER_MASK) > osdBufferSize))
+    osdSent = osdConsumed;
+  osdEpoch = params[STATUS_EPOCH];
+}
+
+//******************************************************************************
+//* function: osd_counters
+//*         : stores the MinimOSD profiling counters from a counters frame
+//******************************************************************************
+void osd_counters( const unsigned char *params )
+{
+  unsigned char i;
+
+  for (i = 0; i < COUNTERS_COUNT; i++, params += 3)
+    osdCounters[i] = ((unsigned long)params[0] << 14) | (params[1] << 7) | params[2];
+}
+
+//******************************************************************************
+//* function: osd_credits
+//*         : returns the number of bytes the MinimOSD can receive right now
+//******************************************************************************
+unsigned int osd_credits( void )
+{
+  unsigned int inFlight = (osdSent - osdConsumed) & OSD_COUNTER_MASK;
+  return (inFlight < osdBufferSize) ? osdBufferSize - inFlight : 0;
+}
+
+//******************************************************************************
+//* function: osd_reserve
+//*         : waits until size bytes can be sent without overrunning the
+//*         : MinimOSD receive buffer and counts them as sent. If the MinimOSD
+//*         : stops sending status frames the flow control is turned off.
+//******************************************************************************
+void osd_reserve( unsigned char size )
+{
+  unsigned long start;
+
+  osd_poll();
+  if ((osdBufferSize && (osd_credits() < size)) || (Serial.availableForWrite() < size)) {
+    start = micros();
+    while (osdBufferSize && (osd_credits() < size)) {
+      osd_poll();
+      if (millis() - osdStatusTime > OSD_STATUS_TIMEOUT_MS)
+        osdBufferSize = 0;
+    }
+    while (Serial.availableForWrite() < size) ;
+    addSample( profileOsdWait, micros() - start );
+  }
+  osdSent = (osdSent + size) & OSD_COUNTER_MASK;
+  osdTraffic[osdScreen].bytes += size;
+}
+
+//******************************************************************************
+//* function: osd_advance
+//*         : moves the tracked MinimOSD cursor past printed characters
+//******************************************************************************
+void osd_advance( unsigned char count )
+{
+  if (osdCursorX != OSD_CURSOR_UNKNOWN)
+    osdCursorX += count;
+  if (osdCursorX >= OSD_COLUMNS)
+    osdCursorX = OSD_CURSOR_UNKNOWN;
+}
+
+//******************************************************************************
+//* function: osd_flush
+//*         : waits until the MinimOSD has consumed all sent bytes
+//******************************************************************************
+void osd_flush( void )
+{
+  while (osdBufferSize && (osd_credits() < osdBufferSize)) {
+    osd_poll();
+    if (millis() - osdStatusTime > OSD_STATUS_TIMEOUT_MS)
+      osdBufferSize = 0;
+  }
+}
+
+//******************************************************************************
+//* function: waitForOsd
+//*         : waits for the first status frame from a booting MinimOSD
+//******************************************************************************
+void waitForOsd( unsigned long timeout )
+{
+  timeout += millis();
+  while (!osdBufferSize && (millis() < timeout))
+    osd_poll();
+}
+
 //******************************************************************************
 //* function: osd
 //******************************************************************************
 void osd( unsigned char command )
 {
-  while (Serial.availableForWrite() < 2) ;
+  osd_reserve(2);
   Serial.write( CMD_CMD );
   Serial.write( command );
+  osdTraffic[osdScreen].commands++;
+  if (command == CMD_NEWLINE) {
+    osdCursorX = 0;
+    osdCursorY = OSD_CURSOR_UNKNOWN;
+  }
 }
 
 //******************************************************************************
@@ -971,10 +2082,21 @@ void osd( unsigned char command )
 //******************************************************************************
 void osd( unsigned char command, unsigned char param )
 {
-  while (Serial.availableForWrite() < 3) ;
+  osd_reserve(3);
   Serial.write( CMD_CMD );
   Serial.write( command );
   Serial.write( param );
+  osdTraffic[osdScreen].commands++;
+  if (command == CMD_SET_X) {
+    if (param == osdCursorX)
+      osdTraffic[osdScreen].redundantMoves++;
+    osdCursorX = param;
+  }
+  else if (command == CMD_SET_Y) {
+    if (param == osdCursorY)
+      osdTraffic[osdScreen].redundantMoves++;
+    osdCursorY = param;
+  }
 }
 
 //******************************************************************************
@@ -982,8 +2104,9 @@ void osd( unsigned char command, unsigned char param )
 //******************************************************************************
 void osd_char( unsigned char token )
 {
-  while (Serial.availableForWrite() == 0) ;
+  osd_reserve(1);
   Serial.write( token );
+  osd_advance(1);
 }
 
 //******************************************************************************
@@ -991,10 +2114,23 @@ void osd_char( unsigned char token )
 //******************************************************************************
 void osd_int( unsigned int integer )
 {
-  char buff[17];
-  itoa(integer, buff, 10);
-  while (Serial.availableForWrite() < strlen(buff)) ;
+  char buff[6];
+  utoa(integer, buff, 10);
+  osd_reserve(strlen(buff));
   Serial.write(buff);
+  osd_advance(strlen(buff));
+}
+
+//******************************************************************************
+//* function: osd_long
+//******************************************************************************
+void osd_long( unsigned long integer )
+{
+  char buff[11];
+  ultoa(integer, buff, 10);
+  osd_reserve(strlen(buff));
+  Serial.write(buff);
+  osd_advance(strlen(buff));
 }
 
 //******************************************************************************
@@ -1002,42 +2138,171 @@ void osd_int( unsigned int integer )
 //******************************************************************************
 void osd_string( const char *str )
 {
-  while (Serial.availableForWrite() < strlen(str)) ;
+  osd_reserve(strlen(str));
   Serial.write(str);
+  osd_advance(strlen(str));
+}
+
+
+
+//******************************************************************************
+//* function: osd_survey
+//*         : sends a survey frame
+//******************************************************************************
+void osd_survey( const unsigned char *data, unsigned char size )
+{
+  osd_reserve(4);
+  Serial.write( CMD_CMD );
+  Serial.write( CMD_SURVEY_DATA );
+  Serial.write( size >> 7 );
+  Serial.write( size & 0x7F );
+  osdTraffic[osdScreen].commands++;
+  for ( ; size; size--) {
+    osd_reserve(1);
+    Serial.write( *data++ );
+  }
 }
 
+//******************************************************************************
+//* function: osd_template
+//*         : draws a template stored in the MinimOSD at the given position
+//******************************************************************************
+void osd_template( unsigned char id, unsigned char xPos, unsigned char yPos )
+{
+  osd_reserve(5);
+  Serial.write( CMD_CMD );
+  Serial.write( CMD_DRAW_TEMPLATE );
+  Serial.write( id );
+  Serial.write( xPos );
+  Serial.write( yPos );
+  osdTraffic[osdScreen].commands++;
+  osdCursorX = OSD_CURSOR_UNKNOWN;
+  osdCursorY = OSD_CURSOR_UNKNOWN;
+}
 
+//******************************************************************************
+//* function: templateImage
+//*         : walks through the template image as it is stored in the MinimOSD
+//*         : returns the CRC of the image. The image is sent if send is true
+//******************************************************************************
+unsigned int templateImage( bool send )
+{
+  unsigned int crc = 0xFFFF;
+  unsigned int offset = 1 + 2 * (MAX_TEMPLATES + 1);
+  unsigned char buffer[2];
+  unsigned char i, j, size;
+  const unsigned char *data;
+
+  // Template count
+  buffer[0] = MAX_TEMPLATES;
+  crc = _crc_ccitt_update(crc, buffer[0]);
+  if (send)
+    osd_raw(buffer, 1);
+
+  // Offset table
+  for (i = 0; i <= MAX_TEMPLATES; i++) {
+    buffer[0] = offset & 0xFF;
+    buffer[1] = offset >> 8;
+    crc = _crc_ccitt_update(crc, buffer[0]);
+    crc = _crc_ccitt_update(crc, buffer[1]);
+    if (send)
+      osd_raw(buffer, 2);
+    if (i < MAX_TEMPLATES)
+      offset += pgm_read_byte_near(templateSizes + i);
+  }
+
+  // Template data
+  for (i = 0; i < MAX_TEMPLATES; i++) {
+    data = (const unsigned char *)pgm_read_word_near(templates + i);
+    size = pgm_read_byte_near(templateSizes + i);
+    for (j = 0; j < size; j++) {
+      buffer[0] = pgm_read_byte_near(data + j);
+      crc = _crc_ccitt_update(crc, buffer[0]);
+      if (send)
+        osd_raw(buffer, 1);
+    }
+  }
+  return crc;
+}
+
+//******************************************************************************
+//* function: uploadTemplates
+//*         : sends the screen templates to the MinimOSD. The CRC of the image
+//*         : is remembered once the MinimOSD reports it in a status frame,
+//*         : so the upload is only done once
+//******************************************************************************
+void uploadTemplates( void )
+{
+  unsigned int crc = templateImage(false);
+  unsigned int length = 1 + 2 * (MAX_TEMPLATES + 1);
+  unsigned char i;
+
+  osdScreen = TRAFFIC_OTHER;
+  for (i = 0; i < MAX_TEMPLATES; i++)
+    length += pgm_read_byte_near(templateSizes + i);
+
+  osd_reserve(LOAD_TEMPLATES_PARAMS + 2);
+  Serial.write( CMD_CMD );
+  Serial.write( CMD_LOAD_TEMPLATES );
+  osdTraffic[osdScreen].commands++;
+  Serial.write( crc >> 14 );
+  Serial.write( (crc >> 7) & 0x7F );
+  Serial.write( crc & 0x7F );
+  Serial.write( (length >> 7) & 0x7F );
+  Serial.write( length & 0x7F );
+  templateImage(true);
+  templateUploads++;
+
+  // The status frame that reports the last byte as consumed carries the
+  // CRC of the stored templates
+  osd_flush();
+  if (osdBufferSize && (osdTemplateHash == crc))
+    storeTemplateHash( crc );
+}
+
+//******************************************************************************
+//* function: storeTemplateHash
+//*         : remembers that the MinimOSD holds the current templates
+//******************************************************************************
+void storeTemplateHash( unsigned int hash )
+{
+  EEPROM.write(EEPROM_TEMPLATE_HASH, hash & 0xFF);
+  EEPROM.write(EEPROM_TEMPLATE_HASH + 1, hash >> 8);
+}
+
+//******************************************************************************
+//* function: updateTemplates
+//*         : uploads the templates if the MinimOSD reports another set, e.g.
+//*         : after a MinimOSD swap or a failed upload. A MinimOSD that keeps
+//*         : failing is given up on after TEMPLATE_UPLOAD_TRIES uploads.
+//******************************************************************************
+void updateTemplates( void )
+{
+  if (osdBufferSize && (osdTemplateHash != templateHash) && (templateUploads < TEMPLATE_UPLOAD_TRIES))
+    uploadTemplates();
+}
+
+//******************************************************************************
+//* function: osd_raw
+//*         : sends raw data bytes. The MinimOSD writes each byte to EEPROM, so
+//*         : the bytes are paced if there is no flow control
+//******************************************************************************
+void osd_raw( const unsigned char *data, unsigned char size )
+{
+  for ( ; size; size--) {
+    osd_reserve(1);
+    Serial.write( *data++ );
+    if (!osdBufferSize)
+      delay( TEMPLATE_BYTE_DELAY_MS );
+  }
+}
 
 //******************************************************************************
 //* function: drawLogo
 //*         : displays the program Logo
 //******************************************************************************
 void drawLogo( unsigned char xPos, unsigned char yPos) {
-  // Set Position
-  osd( CMD_SET_X, xPos );
-  osd( CMD_SET_Y, yPos );
-
-  // Display Logo
-  osd(CMD_ENABLE_INVERSE);
-  osd_char( OSD_LOGO );
-  osd_char( OSD_LOGO + 1 );
-  osd_char( OSD_LOGO + 2 );
-  osd_char( OSD_LOGO + 3 );
-  osd_char( OSD_LOGO + 4 );
-  osd_char( OSD_LOGO + 5 );
-  osd_char( OSD_LOGO + 6 );
-  osd_char( OSD_LOGO + 7 );
-  osd( CMD_SET_X, xPos );
-  osd( CMD_SET_Y, yPos + 1 );
-  osd_char( OSD_LOGO + 8 );
-  osd_char( OSD_LOGO + 9 );
-  osd_char( OSD_LOGO + 10 );
-  osd_char( OSD_LOGO + 11);
-  osd_char( OSD_LOGO + 12);
-  osd_char( OSD_LOGO + 13 );
-  osd_char( OSD_LOGO + 14 );
-  osd_char( OSD_LOGO + 15 );
-  osd(CMD_DISABLE_INVERSE);
+  osd_template( TEMPLATE_LOGO, xPos, yPos );
 }
 
 //******************************************************************************
@@ -1045,20 +2310,13 @@ void drawLogo( unsigned char xPos, unsigned char yPos) {
 //*         : displays the boot screen
 //******************************************************************************
 void drawStartScreen( void ) {
-  unsigned char i;
-
+  osdScreen = TRAFFIC_START_SCREEN;
   // Display Logo
   drawLogo( 1, 0 );
 
-  // Display version date
-  osd( CMD_SET_X, 10 );
-  osd( CMD_SET_Y, 0 );
-  osd_string(VER_DATE_STRING);
-
-  // Display version information
-  osd( CMD_SET_X, 10 );
-  osd( CMD_SET_Y, 1 );
-  osd_string(VER_INFO_STRING);
+  // Display version date and information
+  osd_template( TEMPLATE_VERSION_DATE, 10, 0 );
+  osd_template( TEMPLATE_VERSION_INFO, 10, 1 );
 
   // Display battery status
   batteryMeter( GetRightBatteryX(25), 0 );
@@ -1097,6 +2355,13 @@ uint8_t drawFunctionScreen( uint8_t function )
   function == 3 ? osd(CMD_ENABLE_INVERSE) : osd(CMD_DISABLE_INVERSE);
   function == 3 ? osd(CMD_ENABLE_FILL) : osd(CMD_DISABLE_FILL);
   osd_string(" Options         ");
+
+  osd(CMD_SET_X, XPOS);
+  osd(CMD_SET_Y, YPOS + 4);
+  function == 4 ? osd(CMD_ENABLE_INVERSE) : osd(CMD_DISABLE_INVERSE);
+  function == 4 ? osd(CMD_ENABLE_FILL) : osd(CMD_DISABLE_FILL);
+  osd_string(" Survey          ");
+  return function;
 }
 
 //******************************************************************************
@@ -1106,6 +2371,7 @@ void drawAutoScanScreen( void ) {
   char buffer[22];
   unsigned char answer;
 
+  osdScreen = TRAFFIC_SCANNER;
   drawLogo(1, 0);
   batteryMeter(GetRightBatteryX(25), 0);
 
@@ -1124,17 +2390,73 @@ void drawAutoScanScreen( void ) {
 //* function: drawScannerScreen
 //******************************************************************************
 void drawScannerScreen( void ) {
-  osd(CMD_SET_X, 0);
-  osd(CMD_SET_Y, 11);
-  for (int i = 0; i < 30 ; i++) {
-    osd_char(OSD_BAR_EMPTY);
-  }
-  osd(CMD_SET_X, 0);
-  osd(CMD_SET_Y, 12);
+  osdScreen = TRAFFIC_SCANNER;
+  // Use the extra lines of PAL screens
+  scannerBarLine = (osdVideoFormat == VIDEO_PAL) ? SCANNER_BAR_LINE_PAL : SCANNER_BAR_LINE_NTSC;
+  scannerCursor = OSD_COLUMNS;
+  osd_template( TEMPLATE_SCANNER_BAR, 0, scannerBarLine );
   if ( options[L_BAND_OPTION] )
-    osd_string(" 5.35       5.60       5.95");
+    osd_template( TEMPLATE_SCANNER_LABELS_L, 0, scannerBarLine + 1 );
+  else
+    osd_template( TEMPLATE_SCANNER_LABELS, 0, scannerBarLine + 1 );
+}
+
+//******************************************************************************
+//* function: drawScannerCursor
+//*         : marks a column on the line above the scanner bars and shows
+//*         : the frequency of the cursor in the middle of the labels
+//******************************************************************************
+void drawScannerCursor( unsigned char column, unsigned int frequency ) {
+  osdScreen = TRAFFIC_SCANNER;
+  if (scannerCursor < OSD_COLUMNS) {
+    osd(CMD_SET_X, scannerCursor);
+    osd(CMD_SET_Y, scannerBarLine - SCANNER_ROWS);
+    osd_char(' ');
+  }
+  scannerCursor = column;
+  osd(CMD_SET_X, scannerCursor);
+  osd(CMD_SET_Y, scannerBarLine - SCANNER_ROWS);
+  osd_char('v');
+
+  osd(CMD_SET_X, 10);
+  osd(CMD_SET_Y, scannerBarLine + 1);
+  osd_char(' ');
+  osd_int( frequency );
+  osd_char(OSD_MHZ);
+  osd_char(' ');
+}
+
+//******************************************************************************
+//* function: barGlyph
+//*         : returns the bar character of a scanner row for two half
+//*         : columns. Each row holds two levels of the values 0 to 24.
+//******************************************************************************
+unsigned char barGlyph( unsigned char value1, unsigned char value2, unsigned char row ) {
+  bool barCells[4];
+
+  barCells[0] = (value1 >= ((row * 2) + 2));
+  barCells[1] = (value2 >= ((row * 2) + 2));
+  barCells[2] = (value1 >= ((row * 2) + 1));
+  barCells[3] = (value2 >= ((row * 2) + 1));
+
+  if (barCells[0] && barCells[1] && barCells[2] && barCells[3])
+    return OSD_BAR_1111;
+  else if ((!barCells[0]) && barCells[1] && barCells[2] && barCells[3])
+    return OSD_BAR_0111;
+  else if (barCells[0] && (!barCells[1]) && barCells[2] && barCells[3])
+    return OSD_BAR_1011;
+  else if ((!barCells[0]) && (!barCells[1]) && barCells[2] && barCells[3])
+    return OSD_BAR_0011;
+  else if ((!barCells[0]) && (!barCells[1]) && (!barCells[2]) && barCells[3])
+    return OSD_BAR_0001;
+  else if ((!barCells[0]) && (!barCells[1]) && barCells[2] && (!barCells[3]))
+    return OSD_BAR_0010;
+  else if (barCells[0] && !barCells[1] && barCells[2] && !barCells[3])
+    return OSD_BAR_1010;
+  else if (!barCells[0] && barCells[1] && !barCells[2] && barCells[3])
+    return OSD_BAR_0101;
   else
-    osd_string(" 5.65       5.80       5.95");
+    return (row == 0 ? OSD_BAR_EMPTY : ' ');
 }
 
 //******************************************************************************
@@ -1149,41 +2471,18 @@ void updateScannerScreen(unsigned char position, unsigned char value1, unsigned
   static unsigned char last_position = 0;
   static unsigned char last_value1 = 0;
   static unsigned char last_value2 = 0;
-  bool barCells[4];
 
-  for (i = 0; i < 12; i++)
+  osdScreen = TRAFFIC_SCANNER;
+  for (i = 0; i < SCANNER_ROWS; i++)
   {
     // Errase the scan line character from last call
     osd(CMD_SET_X, last_position);
-    osd(CMD_SET_Y, 11 - i);
-
-    barCells[0] = (last_value1 >= ((i * 2) + 2));
-    barCells[1] = (last_value2 >= ((i * 2) + 2));
-    barCells[2] = (last_value1 >= ((i * 2) + 1));
-    barCells[3] = (last_value2 >= ((i * 2) + 1));
-
-    if (barCells[0] && barCells[1] && barCells[2] && barCells[3])
-      osd_char(OSD_BAR_1111);
-    else if ((!barCells[0]) && barCells[1] && barCells[2] && barCells[3])
-      osd_char(OSD_BAR_0111);
-    else if (barCells[0] && (!barCells[1]) && barCells[2] && barCells[3])
-      osd_char(OSD_BAR_1011);
-    else if ((!barCells[0]) && (!barCells[1]) && barCells[2] && barCells[3])
-      osd_char(OSD_BAR_0011);
-    else if ((!barCells[0]) && (!barCells[1]) && (!barCells[2]) && barCells[3])
-      osd_char(OSD_BAR_0001);
-    else if ((!barCells[0]) && (!barCells[1]) && barCells[2] && (!barCells[3]))
-      osd_char(OSD_BAR_0010);
-    else if (barCells[0] && !barCells[1] && barCells[2] && !barCells[3])
-      osd_char(OSD_BAR_1010);
-    else if (!barCells[0] && barCells[1] && !barCells[2] && barCells[3])
-      osd_char(OSD_BAR_0101);
-    else
-      osd_char(i == 0 ? OSD_BAR_EMPTY : ' ');
+    osd(CMD_SET_Y, scannerBarLine - i);
 
+    osd_char(barGlyph( last_value1, last_value2, i ));
     // Draw the current scan line character
     osd(CMD_SET_X, position);
-    osd(CMD_SET_Y, 11 - i);
+    osd(CMD_SET_Y, scannerBarLine - i);
     osd_char(i == 0 ? OSD_FILLED : ' ');
   }
   // Save position and values for the next pass
@@ -1228,7 +2527,9 @@ void drawOptionsScreen(unsigned char option, unsigned char in_edit_state ) {
   unsigned char i, j;
   unsigned int voltage = getVoltage();
 
-  drawStartScreen();
+  osdScreen = TRAFFIC_OPTIONS;
+  // The static start screen is drawn once by setOptions. Only the battery changes
+  batteryMeter( GetRightBatteryX(25), 0 );
   if (option != 0)
     j = option - 1;
   else
@@ -1236,8 +2537,6 @@ void drawOptionsScreen(unsigned char option, unsigned char in_edit_state ) {
 
   for (i = 0; i < MAX_OPTION_LINES; i++, j++)
   {
-    osd( CMD_SET_Y, i + 3 );
-    osd( CMD_SET_X, 0 );
     if (j >= (MAX_OPTIONS + MAX_COMMANDS))
       j = 0;
 
@@ -1250,25 +2549,7 @@ void drawOptionsScreen(unsigned char option, unsigned char in_edit_state ) {
       osd( CMD_DISABLE_FILL );
       osd( CMD_DISABLE_INVERSE );
     }
-    switch (j) {
-      case BATTERY_ALARM_OPTION:     osd_string("battery alarm      "); break;
-      case ALARM_LEVEL_OPTION:       osd_string("alarm sound level  "); break;
-      case BATTERY_TYPE_OPTION:      osd_string("battery type       "); break;
-      case BATTERY_CALIB_OPTION:     osd_string("volt calibration   "); break;
-      case SHOW_STARTSCREEN_OPTION:  osd_string("show start screen  "); break;
-      case INFO_LINE_OPTION:         osd_string("constant info line "); break;
-      case INFO_LINE_POS_OPTION:     osd_string("info line position "); break;
-      case A_BAND_OPTION:            osd_string("boscam a band      "); break;
-      case B_BAND_OPTION:            osd_string("boscam b band      "); break;
-      case E_BAND_OPTION:            osd_string("foxtech/dji band   "); break;
-      case F_BAND_OPTION:            osd_string("fatshark band      "); break;
-      case R_BAND_OPTION:            osd_string("race band          "); break;
-      case L_BAND_OPTION:            osd_string("low band           "); break;
-      case BATTERY_TEXT_OPTION:      osd_string("show bat percentage"); break;
-      case RESET_SETTINGS_COMMAND:   osd_string("reset settings     "); break;
-      case TEST_ALARM_COMMAND:       osd_string("test alarm         "); break;
-      case EXIT_COMMAND:             osd_string("exit               "); break;
-    }
+    osd_template( TEMPLATE_OPTION_LABELS + j, 0, i + 3 );
     if ((j == option) && in_edit_state) {
       osd( CMD_ENABLE_FILL );
       osd( CMD_ENABLE_INVERSE );
@@ -1294,6 +2575,8 @@ void drawOptionsScreen(unsigned char option, unsigned char in_edit_state ) {
         case R_BAND_OPTION:           osd_string(options[j] ? "on     " : "off    "); break;
         case L_BAND_OPTION:           osd_string(options[j] ? "on     " : "off    "); break;
         case BATTERY_TEXT_OPTION:     osd_string(options[j] ? "on     " : "off    "); break;
+        case LOS_WARNING_OPTION:      osd_string(options[j] == LOS_GRAY ? "gray   " : (options[j] ? "text   " : "off    ")); break;
+        case REACQUIRE_OPTION:        osd_string(options[j] ? "on     " : "off    "); break;
       }
     }
     else
@@ -1304,51 +2587,115 @@ void drawOptionsScreen(unsigned char option, unsigned char in_edit_state ) {
 }
 
 //******************************************************************************
-//* function: drawLeftInfoLine
+//* function: drawInfoLine
+//*         : sends the raw info line values to the MinimOSD, which formats
+//*         : and places the info line according to the layout flags. The
+//*         : frequency is the tuned one, which is off the channel grid after
+//*         : a zoomed scan or a re-acquire.
 //******************************************************************************
-void drawLeftInfoLine( void )
+void drawInfoLine( void )
 {
-  char buffer[3];
-  uint8_t startX = 1;
-  uint8_t startXText = startX + BATTERY_SYMBOL_X_OFFSET_LEFT;
-
+  unsigned int frequency = receiver.getFrequency();
+  unsigned int rssi = signalRssi = averageAnalogRead(RSSI_PIN);
+  unsigned char battery = batteryLevel();
+  unsigned char flags = 0;
+
+  osdScreen = TRAFFIC_INFO_LINE;
+  if (options[INFO_LINE_POS_OPTION])
+    flags |= INFO_FLAG_LEFT;
   if (options[BATTERY_TEXT_OPTION])
-  {
-    startXText += BATTERY_TEXT_WIDTH;
-  }
-  
-  batteryMeter(startX, 0);
-  osd( CMD_SET_X, startXText );
-  osd( CMD_SET_Y, 0);
-  osd_string(shortNameOfChannel(currentChannel, buffer));
-  osd_char(OSD_SPACE);
-  osd_char(OSD_MHZ);
-  osd_int(getFrequency(currentChannel));
-  osd_char(OSD_SPACE);
-  osd_char(OSD_ANTENNA);
-  osd_int(averageAnalogRead(RSSI_PIN));
+    flags |= INFO_FLAG_BAT_TEXT;
+
+  osd_reserve(INFO_LINE_PARAMS + 2);
+  Serial.write( CMD_CMD );
+  Serial.write( CMD_INFO_LINE );
+  Serial.write( getPosition(currentChannel) );
+  Serial.write( (frequency >> 7) & 0x7F );
+  Serial.write( frequency & 0x7F );
+  Serial.write( (rssi >> 7) & 0x7F );
+  Serial.write( rssi & 0x7F );
+  Serial.write( battery );
+  Serial.write( flags );
+  osdTraffic[osdScreen].commands++;
+  osdCursorX = OSD_CURSOR_UNKNOWN;
+  osdCursorY = OSD_CURSOR_UNKNOWN;
 }
 
 //******************************************************************************
-//* function: drawRightInfoLine
+//* function: drawDebugLine
+//*         : draws a label followed by count values on a line. The values
+//*         : are right aligned in equal fields that end at the right margin.
+//*         : Values too long for their field are cut to a digit and a power
+//*         : of ten, e.g. 2e4. Fields must be at least 4 characters wide.
 //******************************************************************************
-void drawRightInfoLine( void )
+void drawDebugLine( unsigned char line, const char *label, const unsigned long *values, unsigned char count )
 {
-  char buffer[3];
-  uint8_t startX = 12;
+  unsigned char width = (OSD_COLUMNS - 2 - strlen(label)) / count;   // With a space before the value
+  unsigned char length;
+  unsigned char digits;
+  char buff[11];
 
-  if (options[BATTERY_TEXT_OPTION])
-  {
-    startX -= BATTERY_TEXT_WIDTH;
+  osd( CMD_SET_X, 1 );
+  osd( CMD_SET_Y, line );
+  osd_string( label );
+  osd( CMD_SET_X, OSD_COLUMNS - 1 - width * count );
+  for ( ; count; count--) {
+    length = strlen( ultoa( *values++, buff, 10 ) );
+    if (length > width - 1) {
+      digits = width - 3;
+      buff[digits] = 'e';
+      buff[digits + 1] = '0' + length - digits;
+      buff[digits + 2] = 0;
+      length = digits + 2;
+    }
+    for ( ; length < width; length++)
+      osd_char( ' ' );
+    osd_string( buff );
   }
-  osd( CMD_SET_X, startX);
-  osd( CMD_SET_Y, 0);
-  osd_string(shortNameOfChannel(currentChannel, buffer));
-  osd_char(OSD_SPACE);
-  osd_char(OSD_MHZ);
-  osd_int(getFrequency(currentChannel));
-  osd_char(OSD_SPACE);
-  osd_char(OSD_ANTENNA);
-  osd_int(averageAnalogRead(RSSI_PIN));
-  batteryMeter(GetRightBatteryX(25), 0);
+}
+
+//******************************************************************************
+//* function: drawDebugScreen
+//*         : draws the profiling counters. Times are in microseconds unless
+//*         : the label says ms. The MinimOSD values come from the last
+//*         : counters frame.
+//******************************************************************************
+void drawDebugScreen( void )
+{
+  const char * const osdLabels[COUNTERS_COUNT] = { "osd rx bytes", "osd rx lost",
+                                                   "osd spi bytes", "osd busy ms", "osd max cells" };
+  unsigned long values[3];
+  unsigned char i;
+
+  osdScreen = TRAFFIC_OTHER;
+  osd( CMD_CLEAR_SCREEN );
+  values[0] = profileLoop.min;
+  values[1] = averageSample(profileLoop);
+  values[2] = profileLoop.max;
+  drawDebugLine( 1, "loop min avg max", values, 3 );
+  values[0] = profileOsdWait.count;
+  values[1] = profileOsdWait.total / 1000;
+  values[2] = profileOsdWait.max;
+  drawDebugLine( 2, "osd waits ms max", values, 3 );
+  values[0] = averageSample(profileAdc);
+  values[1] = profileAdc.max;
+  drawDebugLine( 3, "adc avg max", values, 2 );
+  values[0] = profileScan.count;
+  values[1] = averageSample(profileScan) / 1000;
+  values[2] = profileScan.max / 1000;
+  drawDebugLine( 4, "scans avg max ms", values, 3 );
+  values[0] = receiver.getTuneCount() - tuneBase;
+  values[1] = averageSample(profileSweep) / 1000;
+  drawDebugLine( 5, "tunes sweep ms", values, 2 );
+  values[0] = eepromSaves;
+  drawDebugLine( 6, "eeprom saves", values, 1 );
+  for (i = 0; i < COUNTERS_COUNT; i++) {
+    values[0] = osdCounters[i];
+    if (i != COUNTERS_MAX_CELLS / 3)
+      values[0] = (values[0] - osdCountersBase[i]) & COUNTERS_MASK;
+    drawDebugLine( 7 + i, osdLabels[i], values, 1 );
+  }
+  values[0] = rssiMin;
+  values[1] = rssiMax;
+  drawDebugLine( 12, "rssi min max", values, 2 );
 }
@@ -36,7 +36,15 @@ rtc6715::rtc6715(unsigned int clock_pin, unsigned int slave_select_pin, unsigned
   spi_clock_pin = clock_pin;
   spi_slave_select_pin = slave_select_pin;
   spi_data_pin = data_pin;
+}
 
+//******************************************************************************
+//* function: begin
+//*         : sets up the SPI pins. Called from setup, since the constructor of
+//*         : a global object runs before the Arduino core is initialized.
+//******************************************************************************
+void rtc6715::begin( void )
+{
   // SPI pins for RX control
   pinMode (spi_slave_select_pin, OUTPUT);
   pinMode (spi_data_pin, OUTPUT);
@@ -78,6 +86,12 @@ void rtc6715::setFrequency(unsigned int frequency)
   unsigned int sRegB;
   unsigned char i;
 
+  // The synthesizer keeps its setting, so there is no need to write it again
+  if (frequency == this->frequency)
+    return;
+  this->frequency = frequency;
+  tuneCount++;
+
   sRegB = calcFrequencyData(frequency);
 
   // Bit bang the syntheziser register
@@ -115,6 +129,25 @@ void rtc6715::setFrequency(unsigned int frequency)
   digitalWrite(spi_data_pin, LOW);
 }
 
+//******************************************************************************
+//* function: getFrequency
+//*         : returns the frequency the receiver is tuned to
+//******************************************************************************
+unsigned int rtc6715::getFrequency( void )
+{
+  return frequency;
+}
+
+//******************************************************************************
+//* function: getTuneCount
+//*         : returns the number of synthesizer writes since start. Used to
+//*         : measure the cost of the scanning algorithms.
+//******************************************************************************
+unsigned long rtc6715::getTuneCount( void )
+{
+  return tuneCount;
+}
+
 
 //******************************************************************************
 //* function: spi_1
@@ -31,8 +31,11 @@ class rtc6715
 {
   public:
     rtc6715( unsigned int spi_clock_pin, unsigned int spi_slave_select_pin, unsigned int spi_data_pin );
+    void begin( void );
     long readRegister( unsigned char reg );
     void setFrequency(unsigned int frequency);
+    unsigned int getFrequency( void );
+    unsigned long getTuneCount( void );
 
   private:
     unsigned int calcFrequencyData( unsigned int frequency );
@@ -45,6 +48,8 @@ class rtc6715
     unsigned int spi_clock_pin = 0;
     unsigned int spi_slave_select_pin = 0;
     unsigned int spi_data_pin = 0;
+    unsigned int frequency = 0;       // Tuned frequency, 0 before the first tune
+    unsigned long tuneCount = 0;      // Synthesizer writes since start
 };
 
 #endif // rtc6715_h
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+  File: survey2csv.py
+
+  Author: Kjell Kernen
+
+  Extracts the survey frames from a capture of the CYCLOP++ to MinimOSD serial
+  line (57600 baud 8N1, taken from the CYCLOP++ TX pin with any USB serial
+  adapter) and writes them as:
+    <name>_sweeps.csv   one row per sweep: time in ms, then RSSI per frequency
+    <name>_samples.csv  time in ms, frequency in MHz, RSSI, battery voltage
+    <name>.pgm          waterfall image, one row per sweep, brighter is stronger
+  Display commands and text in the capture are skipped.
+
+  Usage: survey2csv.py capture.bin [name]
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+"""
+import os
+import sys
+
+CMD_CMD = 255
+CMD_LOAD_TEMPLATES = 18
+CMD_SURVEY_DATA = 22
+
+# Number of params of each command, as commandParams in minimosd_for_cyclop.ino
+COMMAND_PARAMS = {14: 1, 15: 1, 16: 7, 17: 3, 18: 5, 19: 1, 22: 2}
+
+SURVEY_SWEEP = 1
+SURVEY_SAMPLE = 2
+SURVEY_SWEEP_HEADER = 9
+SURVEY_SAMPLE_SIZE = 11
+
+
+def little_endian(data):
+    value = 0
+    for b in reversed(data):
+        value = (value << 8) | b
+    return value
+
+
+def survey_frames(data):
+    """Returns the payloads of all CMD_SURVEY_DATA commands, parsing the stream
+    the way parseByte in minimosd_for_cyclop.ino does"""
+    frames = []
+    pos = 0
+    while pos < len(data):
+        if data[pos] != CMD_CMD:
+            pos += 1                    # Text
+            continue
+        while pos < len(data) and data[pos] == CMD_CMD:
+            pos += 1
+        if pos >= len(data):
+            break
+        command = data[pos]
+        pos += 1
+        params = data[pos:pos + COMMAND_PARAMS.get(command, 0)]
+        if CMD_CMD in params:           # CMD_CMD aborts params
+            pos += params.index(CMD_CMD)
+            continue
+        pos += len(params)
+        if command == CMD_LOAD_TEMPLATES and len(params) == 5:
+            pos += (params[3] << 7) | params[4]
+        elif command == CMD_SURVEY_DATA and len(params) == 2:
+            size = (params[0] << 7) | params[1]
+            frames.append(data[pos:pos + size])
+            pos += size
+    return frames
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit('Usage: survey2csv.py capture.bin [name]')
+    name = sys.argv[2] if len(sys.argv) > 2 else os.path.splitext(sys.argv[1])[0]
+    data = bytearray(open(sys.argv[1], 'rb').read())
+
+    sweeps = []
+    samples = []
+    for frame in survey_frames(data):
+        if frame[:1] == bytes([SURVEY_SWEEP]) and len(frame) >= SURVEY_SWEEP_HEADER:
+            count = frame[8]
+            if len(frame) == SURVEY_SWEEP_HEADER + count:
+                sweeps.append((little_endian(frame[1:5]), little_endian(frame[5:7]),
+                               frame[7], list(frame[SURVEY_SWEEP_HEADER:])))
+        elif frame[:1] == bytes([SURVEY_SAMPLE]) and len(frame) == SURVEY_SAMPLE_SIZE:
+            samples.append((little_endian(frame[1:5]), little_endian(frame[5:7]),
+                            little_endian(frame[7:9]), little_endian(frame[9:11]) / 10.0))
+
+    if sweeps:
+        first, step, width = sweeps[0][1], sweeps[0][2], len(sweeps[0][3])
+        sweeps = [s for s in sweeps if (s[1], s[2], len(s[3])) == (first, step, width)]
+        with open(name + '_sweeps.csv', 'w') as f:
+            f.write('time_ms,' + ','.join(str(first + i * step) for i in range(width)) + '\n')
+            for time, _, _, bins in sweeps:
+                f.write('%d,%s\n' % (time, ','.join(str(rssi) for rssi in bins)))
+        with open(name + '.pgm', 'wb') as f:
+            f.write(b'P5\n%d %d\n255\n' % (width, len(sweeps)))
+            for _, _, _, bins in sweeps:
+                f.write(bytes(bins))
+
+    with open(name + '_samples.csv', 'w') as f:
+        f.write('time_ms,frequency_mhz,rssi,voltage\n')
+        for sample in samples:
+            f.write('%d,%d,%d,%.1f\n' % sample)
+
+    print('%d sweeps, %d samples' % (len(sweeps), len(samples)))
+
+
+if __name__ == '__main__':
+    main()
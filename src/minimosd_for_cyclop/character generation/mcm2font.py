@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+  File: mcm2font.py
+
+  Author: Kjell Kernen
+
+  Compresses a MAX7456 font (.mcm file made with MAX7456Charwizard) into the
+  font.h file used by MinimOSD for CYCLOP++.
+
+  A character is 18 rows of 3 bytes. Rows are coded as:
+    0x00-0xDF  index of a row in the dictionary of the most common rows
+    0xE0-0xFE  the previous row repeated 1-31 more times
+    0xFF       a literal row, the 3 row bytes follow
+  Bytes with value 0x55 (4 transparent pixels) are stored as 0xFF, which is
+  also transparent and is what earlier versions wrote to the character memory.
+
+  Usage: mcm2font.py [file.mcm [font.h]]
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+"""
+import os
+import sys
+from collections import Counter
+
+CHARACTERS = 256
+ROWS = 18
+ROW_BYTES = 3
+MCM_BYTES_PER_CHARACTER = 64    # 54 bytes of data and 10 unused bytes
+DICTIONARY_ROWS = 0xE0
+CODE_REPEAT = 0xE0
+CODE_LITERAL = 0xFF
+MAX_REPEAT = CODE_LITERAL - CODE_REPEAT
+
+
+def read_mcm(path):
+    """Returns the characters of a .mcm file as lists of rows"""
+    lines = open(path).read().split()
+    if lines[0] != 'MAX7456':
+        sys.exit('%s is not a MAX7456 font file' % path)
+    data = [int(line, 2) for line in lines[1:]]
+    if len(data) != CHARACTERS * MCM_BYTES_PER_CHARACTER:
+        sys.exit('%s does not hold %d characters' % (path, CHARACTERS))
+    characters = []
+    for c in range(CHARACTERS):
+        start = c * MCM_BYTES_PER_CHARACTER
+        raw = [0xFF if b == 0x55 else b for b in data[start:start + ROWS * ROW_BYTES]]
+        characters.append([tuple(raw[r * ROW_BYTES:(r + 1) * ROW_BYTES]) for r in range(ROWS)])
+    return characters
+
+
+def build_dictionary(characters):
+    """The most common rows, not counting repeated rows"""
+    count = Counter()
+    for rows in characters:
+        previous = None
+        for row in rows:
+            if row != previous:
+                count[row] += 1
+            previous = row
+    return [row for row, _ in count.most_common(DICTIONARY_ROWS)]
+
+
+def compress(rows, index):
+    """Codes the rows of one character"""
+    code = []
+    previous = None
+    r = 0
+    while r < ROWS:
+        if rows[r] == previous:
+            repeat = 0
+            while r < ROWS and rows[r] == previous and repeat < MAX_REPEAT:
+                repeat += 1
+                r += 1
+            code.append(CODE_REPEAT + repeat - 1)
+            continue
+        if rows[r] in index:
+            code.append(index[rows[r]])
+        else:
+            code.append(CODE_LITERAL)
+            code.extend(rows[r])
+        previous = rows[r]
+        r += 1
+    return code
+
+
+def decompress(dictionary, data, pos):
+    """Decodes one character the way Max7456::decodeCharacter does"""
+    rows = []
+    previous = None
+    while len(rows) < ROWS:
+        code = data[pos]
+        pos += 1
+        if code == CODE_LITERAL:
+            previous = tuple(data[pos:pos + ROW_BYTES])
+            pos += ROW_BYTES
+            rows.append(previous)
+        elif code >= CODE_REPEAT:
+            rows.extend([previous] * (code - CODE_REPEAT + 1))
+        else:
+            previous = dictionary[code]
+            rows.append(previous)
+    return rows, pos
+
+
+def c_array(name, values):
+    lines = []
+    for i in range(0, len(values), 12):
+        lines.append('  ' + ', '.join('0x%02X' % v for v in values[i:i + 12]))
+    return 'const byte %s[%d] PROGMEM = {\n%s\n};\n' % (name, len(values), ',\n'.join(lines))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    mcm = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, 'minimosd_for_cyclop.mcm')
+    out = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, '..', 'font.h')
+
+    characters = read_mcm(mcm)
+    dictionary = build_dictionary(characters)
+    index = {row: i for i, row in enumerate(dictionary)}
+    data = []
+    for rows in characters:
+        data.extend(compress(rows, index))
+
+    # Round trip check
+    pos = 0
+    for c, rows in enumerate(characters):
+        decoded, pos = decompress(dictionary, data, pos)
+        if decoded != rows:
+            sys.exit('Character %d does not decode correctly' % c)
+
+    rows = [b for row in dictionary for b in row]
+    with open(out, 'w') as f:
+        f.write('/*******************************************************************************\n')
+        f.write('   File: font.h\n\n')
+        f.write('   Compressed character set of MinimOSD for CYCLOP++.\n')
+        f.write('   Generated by "character generation/mcm2font.py" from\n')
+        f.write('   %s. Do not edit.\n' % os.path.basename(mcm))
+        f.write('   See Max7456::decodeCharacter for the format.\n')
+        f.write(' *******************************************************************************/\n')
+        f.write('#ifndef FONT_H\n#define FONT_H\n\n#include <Arduino.h>\n\n')
+        f.write(c_array('fontRows', rows))
+        f.write('\n')
+        f.write(c_array('fontData', data))
+        f.write('\n#endif /* FONT_H */\n')
+
+    size = len(rows) + len(data)
+    print('%d characters, %d bytes compressed to %d bytes (ratio %.2f)' %
+          (CHARACTERS, CHARACTERS * ROWS * ROW_BYTES, size,
+           float(CHARACTERS * ROWS * ROW_BYTES) / size))
+
+
+if __name__ == '__main__':
+    main()
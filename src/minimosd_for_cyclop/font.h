@@ -0,0 +1,348 @@
+/*******************************************************************************
+   File: font.h
+
+   Compressed character set of MinimOSD for CYCLOP++.
+   Generated by "character generation/mcm2font.py" from
+   minimosd_for_cyclop.mcm. Do not edit.
+   See Max7456::decodeCharacter for the format.
+ *******************************************************************************/
+#ifndef FONT_H
+#define FONT_H
+
+#include <Arduino.h>
+
+const byte fontRows[672] PROGMEM = {
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x4A, 0xAA, 0xA1, 0x0A, 0x00, 0xA0,
+  0x0A, 0xAA, 0xA0, 0x02, 0xAA, 0x80, 0x52, 0xAA, 0x85, 0x4A, 0x14, 0xA1,
+  0x00, 0x28, 0x00, 0xFF, 0x28, 0xFF, 0x4A, 0x00, 0xA1, 0x50, 0xFF, 0x05,
+  0x54, 0x00, 0x15, 0xFF, 0x41, 0xFF, 0x4A, 0xAA, 0x85, 0x0A, 0xAA, 0x80,
+  0x54, 0xAA, 0x15, 0x0A, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x50, 0x00, 0x05,
+  0x00, 0xAA, 0x00, 0x66, 0x46, 0x64, 0x4A, 0x82, 0xA1, 0x0A, 0x82, 0xA0,
+  0x0A, 0x02, 0xA0, 0x11, 0x11, 0x11, 0x4A, 0x15, 0xFF, 0x19, 0x91, 0x99,
+  0x66, 0x45, 0xFF, 0x19, 0x95, 0xFF, 0xFF, 0x56, 0x64, 0xFF, 0x51, 0x99,
+  0x4A, 0xAA, 0x15, 0x0A, 0xAA, 0x00, 0x4A, 0x00, 0x05, 0x4A, 0x02, 0xA1,
+  0x00, 0xA0, 0x00, 0x52, 0x82, 0x85, 0xFF, 0x2A, 0x15, 0x54, 0xA1, 0xFF,
+  0x02, 0x82, 0x80, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x54, 0xA8, 0xFF,
+  0x50, 0xFF, 0xFF, 0x00, 0x0A, 0x80, 0x00, 0x2A, 0x00, 0x00, 0xA8, 0x00,
+  0x66, 0x66, 0x66, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x48, 0x00, 0x21,
+  0xFF, 0x4A, 0x15, 0xFF, 0x52, 0x85, 0x52, 0x85, 0xFF, 0x54, 0x28, 0x15,
+  0xFF, 0x4A, 0x85, 0x50, 0x00, 0xFF, 0x00, 0x02, 0x80, 0x52, 0xA1, 0xFF,
+  0x4A, 0x28, 0xA1, 0x4A, 0x12, 0xA1, 0x50, 0x00, 0x15, 0x50, 0x00, 0xA1,
+  0x4A, 0x00, 0xFF, 0x0A, 0x28, 0xA0, 0x0A, 0x02, 0x80, 0x02, 0xA0, 0x00,
+  0x4A, 0x0A, 0x85, 0x56, 0xA9, 0x56, 0xA9, 0x56, 0xA9, 0x0A, 0x0A, 0x80,
+  0x02, 0xA8, 0x00, 0x00, 0x2A, 0x80, 0x50, 0xAA, 0x05, 0x52, 0xA8, 0xFF,
+  0x54, 0x28, 0xFF, 0xFF, 0x2A, 0x85, 0x4A, 0x15, 0x05, 0x4A, 0x0A, 0xA1,
+  0x0A, 0x80, 0x00, 0x00, 0x02, 0xA0, 0x0A, 0x0A, 0xA0, 0x48, 0xFF, 0x21,
+  0x4A, 0xA8, 0xFF, 0x54, 0x82, 0x15, 0x11, 0x15, 0xFF, 0x44, 0x45, 0xFF,
+  0xFF, 0x51, 0x11, 0xFF, 0x54, 0x44, 0x54, 0x14, 0x15, 0x50, 0x28, 0x05,
+  0x52, 0xAA, 0x15, 0xFF, 0x54, 0xA1, 0xFF, 0x54, 0x15, 0x4A, 0x00, 0x15,
+  0x52, 0xAA, 0xA1, 0xFF, 0x40, 0x15, 0xFF, 0x28, 0x15, 0x54, 0x01, 0xFF,
+  0x02, 0xAA, 0xA0, 0x0A, 0xA8, 0x00, 0x0A, 0x80, 0xA0, 0x54, 0xFF, 0x15,
+  0x52, 0x14, 0x85, 0x42, 0xAA, 0x81, 0x4A, 0x02, 0x85, 0x54, 0x15, 0xFF,
+  0xFF, 0x42, 0x85, 0x4A, 0x85, 0xFF, 0xFF, 0x52, 0xA1, 0x4A, 0x10, 0xA1,
+  0x4A, 0x12, 0x85, 0x4A, 0x2A, 0xA1, 0x4A, 0x2A, 0x15, 0x56, 0x00, 0x00,
+  0x80, 0x98, 0x00, 0x09, 0xFF, 0xFF, 0x58, 0x02, 0x58, 0x02, 0x58, 0x02,
+  0x02, 0x00, 0x80, 0x02, 0xAA, 0x00, 0x0A, 0x2A, 0xA0, 0x0A, 0x2A, 0x00,
+  0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0x4A, 0x05, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF,
+  0x21, 0x21, 0xFF, 0xFF, 0x52, 0xA8, 0x44, 0x44, 0x44, 0x4A, 0x8A, 0xA1,
+  0x52, 0xA8, 0xA1, 0x54, 0x01, 0x05, 0xFF, 0x51, 0xFF, 0xFF, 0x48, 0xFF,
+  0xFF, 0xFF, 0x05, 0xFF, 0x14, 0xFF, 0xFF, 0x00, 0xA1, 0xFF, 0x50, 0x15,
+  0x50, 0x54, 0xA1, 0x20, 0xAA, 0x08, 0x20, 0x82, 0x08, 0x20, 0x8A, 0xA8,
+  0x54, 0x00, 0xFF, 0xFF, 0x40, 0x05, 0xFF, 0x2A, 0xA1, 0x4A, 0x0A, 0x15,
+  0x4A, 0x84, 0xA1, 0x4A, 0xA0, 0xA1, 0x4A, 0xA8, 0xA1, 0x4A, 0xA8, 0x15,
+  0x40, 0x00, 0x01, 0x2A, 0xAA, 0xA8, 0x4A, 0x80, 0xA1, 0x80, 0x09, 0x80,
+  0xFF, 0x80, 0x02, 0x95, 0x80, 0x02, 0x00, 0x98, 0x00, 0xFF, 0x58, 0x00,
+  0x25, 0x56, 0x00, 0x80, 0x29, 0x56, 0x00, 0x02, 0x56, 0x0A, 0x00, 0x95,
+  0x25, 0x80, 0x25, 0x25, 0x80, 0x09, 0x80, 0x02, 0x80, 0x80, 0x00, 0x02,
+  0x80, 0x02, 0xFF, 0x95, 0xFF, 0xFF, 0x25, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
+  0xFF, 0xAA, 0xFF, 0x56, 0x00, 0x95, 0xFF, 0x56, 0xA9, 0xFF, 0x58, 0x02,
+  0xFF, 0xA8, 0x02, 0x6A, 0x00, 0xA9, 0xA5, 0xFF, 0xFF, 0x0A, 0x28, 0x00,
+  0x02, 0x8A, 0x00, 0x0A, 0x8A, 0xA0, 0x02, 0xA8, 0xA0, 0x00, 0x08, 0x00,
+  0x00, 0x82, 0x00, 0x00, 0x2A, 0xA0, 0x0A, 0x0A, 0x00, 0x0A, 0xA0, 0xA0,
+  0x0A, 0xA8, 0xA0, 0xFF, 0xFF, 0x48, 0xAA, 0xAA, 0x15, 0xAA, 0x15, 0xFF,
+  0x21, 0xFF, 0xFF, 0x2A, 0x05, 0x41, 0x80, 0xA1, 0x28, 0x80, 0x08, 0x28,
+  0x80, 0x02, 0x81, 0xA0, 0x02, 0x85, 0xA0, 0x08, 0x21, 0x28, 0x20, 0x08,
+  0x4A, 0x80, 0x08, 0x4A, 0x80, 0x02, 0x4A, 0xA0, 0x02, 0x50, 0xAA, 0x02,
+  0x54, 0x8A, 0xA8, 0x54, 0x80, 0x01, 0x54, 0x85, 0xFF, 0x2A, 0xAA, 0x15,
+  0x00, 0x00, 0x05, 0x45, 0x45, 0xFF, 0x28, 0xA1, 0xFF, 0x22, 0x21, 0xFF,
+  0x20, 0x21, 0xFF, 0x45, 0x04, 0xFF, 0xFF, 0x14, 0x01, 0xFF, 0x54, 0x21,
+  0xFF, 0x54, 0x81, 0xFF, 0x54, 0x01, 0x52, 0x96, 0x85, 0x52, 0x84, 0xA1,
+  0x54, 0x85, 0x21, 0x4A, 0x28, 0x01, 0x40, 0x28, 0xA1, 0x51, 0xFF, 0xFF
+};
+
+const byte fontData[3264] PROGMEM = {
+  0x01, 0xF0, 0x01, 0x12, 0x4A, 0x02, 0xEC, 0x13, 0x01, 0x12, 0x4A, 0x02,
+  0x33, 0x53, 0x33, 0x02, 0xE8, 0x13, 0x01, 0x12, 0x4A, 0x02, 0x33, 0x53,
+  0xE2, 0x33, 0x02, 0xE5, 0x13, 0x01, 0x12, 0x4A, 0x02, 0x33, 0x53, 0xE5,
+  0x33, 0x02, 0xE2, 0x13, 0x01, 0x12, 0x4A, 0x02, 0x33, 0x53, 0xE8, 0x33,
+  0x02, 0x13, 0x01, 0x7C, 0x7D, 0xBD, 0xEA, 0x7D, 0x7C, 0x01, 0x01, 0x00,
+  0x2A, 0x00, 0x2A, 0xE8, 0x00, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x2A, 0x00,
+  0xBE, 0xE8, 0x00, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x2A, 0x00, 0xBF, 0xE8,
+  0x00, 0x2A, 0x00, 0x01, 0x01, 0x00, 0x2A, 0x00, 0x01, 0xE8, 0x00, 0x2A,
+  0x00, 0x01, 0x01, 0x7E, 0x7F, 0xC0, 0xEA, 0x7F, 0x7E, 0x01, 0xC1, 0xC2,
+  0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE,
+  0x3B, 0x54, 0xCF, 0xD0, 0xD1, 0x80, 0xD2, 0xD3, 0xD4, 0x80, 0xD5, 0x55,
+  0xE0, 0x10, 0x55, 0xE0, 0xD6, 0x81, 0xD7, 0xD8, 0x81, 0xD9, 0x01, 0xE0,
+  0x12, 0x10, 0xDA, 0xE1, 0x10, 0x12, 0x01, 0xE7, 0x2A, 0xF0, 0x01, 0xE7,
+  0x56, 0x1C, 0x1D, 0x1C, 0x1D, 0x1C, 0x1D, 0x1C, 0x56, 0x57, 0x1D, 0x1C,
+  0x1D, 0x1C, 0x1D, 0x1C, 0x1D, 0x57, 0x56, 0x1C, 0x1D, 0x1C, 0x1D, 0x1C,
+  0x1D, 0x1C, 0x56, 0x01, 0xE7, 0x58, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F,
+  0x1E, 0x58, 0x59, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x59, 0x58,
+  0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x58, 0x01, 0xE7, 0x19, 0x15,
+  0x1B, 0x15, 0x1B, 0x15, 0x1B, 0x15, 0x19, 0x57, 0x1D, 0x1C, 0x1D, 0x1C,
+  0x1D, 0x1C, 0x1D, 0x57, 0x19, 0x15, 0x1B, 0x15, 0x1B, 0x15, 0x1B, 0x15,
+  0x19, 0x59, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x1E, 0x1F, 0x59, 0x19, 0x15,
+  0x1B, 0x15, 0x1B, 0x15, 0x1B, 0x15, 0x19, 0x82, 0x1B, 0x15, 0x1B, 0x15,
+  0x1B, 0x15, 0x1B, 0x82, 0x19, 0x15, 0x1B, 0x15, 0x1B, 0x15, 0x1B, 0x15,
+  0x19, 0x01, 0xED, 0x1B, 0x15, 0x19, 0x30, 0x19, 0x30, 0x19, 0x30, 0x19,
+  0x30, 0x19, 0x30, 0x19, 0x30, 0x19, 0x30, 0x19, 0x30, 0x19, 0x30, 0x19,
+  0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
+  0x01, 0xF0, 0x01, 0xE1, 0x0D, 0x09, 0xE7, 0x0D, 0xE0, 0x09, 0xE0, 0x0D,
+  0x01, 0xE0, 0x67, 0x68, 0x16, 0xDB, 0xDC, 0xE0, 0x68, 0x67, 0x01, 0xE6,
+  0x01, 0xE3, 0x5A, 0x25, 0xE0, 0x02, 0xE0, 0x25, 0xE0, 0x02, 0xE0, 0x25,
+  0xE0, 0x5A, 0x01, 0x01, 0xE1, 0x12, 0x09, 0x5B, 0x69, 0x02, 0x3C, 0xDD,
+  0x69, 0xDE, 0x3C, 0x02, 0x69, 0x5B, 0x09, 0x12, 0x01, 0xE1, 0xDF, 0xFF,
+  0x48, 0x54, 0x15, 0xFF, 0x22, 0x12, 0x85, 0xFF, 0x48, 0x4A, 0x85, 0xFF,
+  0x51, 0x4A, 0x15, 0x26, 0x09, 0x2B, 0x27, 0x3B, 0xFF, 0x52, 0x85, 0x15,
+  0xFF, 0x4A, 0x84, 0x85, 0xFF, 0x4A, 0x12, 0x21, 0xFF, 0x4A, 0x14, 0x85,
+  0xFF, 0x50, 0xFF, 0x15, 0x01, 0xE1, 0xFF, 0xFF, 0x01, 0xFF, 0x2B, 0x5C,
+  0xFF, 0x52, 0x8A, 0x15, 0xFF, 0x52, 0x82, 0x15, 0xE0, 0x5C, 0xFF, 0x54,
+  0xA8, 0x45, 0xFF, 0x52, 0xAA, 0x21, 0x83, 0x44, 0x6A, 0x83, 0x84, 0x85,
+  0x01, 0xE0, 0x86, 0x87, 0x26, 0x34, 0xFF, 0xFF, 0x52, 0x15, 0xE0, 0x87,
+  0x86, 0x01, 0xE6, 0x01, 0xE1, 0x88, 0x5D, 0x35, 0x34, 0x09, 0xE5, 0x34,
+  0x35, 0x5D, 0x88, 0x01, 0xE1, 0x6B, 0x36, 0x27, 0x09, 0x34, 0xE5, 0x09,
+  0x27, 0x36, 0x6B, 0x01, 0xE0, 0x89, 0x55, 0x37, 0x06, 0x37, 0x55, 0x89,
+  0x01, 0xE7, 0x01, 0xE6, 0x0D, 0x09, 0x37, 0x06, 0xE0, 0x37, 0x09, 0x0D,
+  0x01, 0xE0, 0x01, 0xEA, 0x0D, 0x09, 0xE0, 0x27, 0x36, 0x6B, 0x01, 0xE8,
+  0x0C, 0x06, 0xE0, 0x0C, 0x01, 0xE2, 0x01, 0xEC, 0x0D, 0x09, 0xE0, 0x0D,
+  0x01, 0xE2, 0xFF, 0xFF, 0x50, 0x05, 0x6C, 0x38, 0xFF, 0xFF, 0x0A, 0x05,
+  0x26, 0x37, 0x2B, 0xFF, 0x50, 0xA0, 0xFF, 0x3B, 0xFF, 0x42, 0x81, 0xFF,
+  0x6D, 0xFF, 0x4A, 0x05, 0xFF, 0x1A, 0xFF, 0x40, 0x15, 0xFF, 0x01, 0xE4,
+  0x0C, 0x06, 0x02, 0x0A, 0x07, 0xE2, 0x0A, 0x02, 0x06, 0x0C, 0x01, 0xE4,
+  0x0D, 0x09, 0x2B, 0x4B, 0x4C, 0x09, 0xE1, 0x37, 0x06, 0xE0, 0x0C, 0x01,
+  0xE4, 0x0C, 0x06, 0x02, 0x0A, 0x3D, 0xFF, 0x50, 0x4A, 0x85, 0x26, 0x2B,
+  0xFF, 0x52, 0xA0, 0x05, 0x02, 0xE0, 0x13, 0x01, 0xE4, 0x3E, 0x0E, 0x02,
+  0x3F, 0x8A, 0xFF, 0x54, 0xAA, 0x85, 0xE0, 0x8A, 0x3F, 0x02, 0x0E, 0x3E,
+  0x01, 0xE4, 0x8B, 0x38, 0x4D, 0xFF, 0x54, 0xA2, 0x85, 0x25, 0x6A, 0x02,
+  0xE0, 0xFF, 0x50, 0x02, 0x85, 0x35, 0xE0, 0x5E, 0x01, 0xE4, 0x13, 0x02,
+  0xE0, 0x22, 0x0E, 0x02, 0x3F, 0x8C, 0x0A, 0x02, 0x06, 0x0C, 0x01, 0xE4,
+  0x0C, 0x06, 0x0E, 0x5F, 0xE0, 0x0E, 0x02, 0x0A, 0xE0, 0x02, 0x06, 0x0C,
+  0x01, 0xE4, 0x13, 0x02, 0xE0, 0x3F, 0x6E, 0x38, 0x26, 0x09, 0xE2, 0x0D,
+  0x01, 0xE4, 0x0C, 0x06, 0x02, 0x0A, 0xE0, 0x06, 0xE0, 0x0A, 0xE0, 0x02,
+  0x06, 0x0C, 0x01, 0xE4, 0x0C, 0x06, 0x02, 0x0A, 0xE0, 0x02, 0x60, 0xFF,
+  0x54, 0x00, 0xA1, 0x3F, 0x02, 0x0E, 0x3E, 0x01, 0xE5, 0x0D, 0x09, 0xE0,
+  0x0D, 0x01, 0xE0, 0x0D, 0x09, 0xE0, 0x0D, 0x01, 0x01, 0xE5, 0x0D, 0x09,
+  0xE0, 0x0D, 0x01, 0xE0, 0x0D, 0x09, 0xE0, 0x27, 0xFF, 0xFF, 0x05, 0xFF,
+  0x01, 0xE4, 0x5E, 0x35, 0x34, 0x09, 0x27, 0x36, 0xE0, 0x27, 0x09, 0x34,
+  0x35, 0x5E, 0x01, 0xE6, 0x0C, 0x06, 0xE0, 0x0C, 0xE0, 0x06, 0xE0, 0x0C,
+  0x01, 0xE0, 0x01, 0xE4, 0x2C, 0x1A, 0x36, 0x27, 0x09, 0x34, 0xE0, 0x09,
+  0x27, 0x36, 0x1A, 0x2C, 0x01, 0xE1, 0x0C, 0x06, 0x02, 0x0A, 0x07, 0x8C,
+  0x6E, 0x38, 0x26, 0x09, 0x0D, 0xE0, 0x09, 0xE0, 0x0D, 0x01, 0xE1, 0x0C,
+  0x06, 0x0A, 0xFF, 0x28, 0xFF, 0x28, 0xFF, 0x21, 0x00, 0x48, 0x8D, 0x8E,
+  0xE0, 0x8F, 0xFF, 0x20, 0xA8, 0xA1, 0xFF, 0x20, 0x01, 0x05, 0xFF, 0x28,
+  0xFF, 0x05, 0x0A, 0x06, 0x0C, 0x01, 0xE0, 0x12, 0x10, 0x06, 0x16, 0x07,
+  0xE2, 0x0A, 0x02, 0xE0, 0x0A, 0x07, 0xE1, 0x0B, 0x01, 0xE0, 0x39, 0x20,
+  0x0E, 0x23, 0x07, 0xE0, 0x23, 0x0E, 0xE0, 0x23, 0x07, 0xE0, 0x23, 0x0E,
+  0x20, 0x39, 0x01, 0xE0, 0x12, 0x10, 0x06, 0x16, 0x07, 0x4E, 0x1A, 0xE2,
+  0x4E, 0x07, 0x16, 0x06, 0x10, 0x12, 0x01, 0xE0, 0x39, 0x20, 0x0E, 0x23,
+  0x07, 0xE6, 0x23, 0x0E, 0x20, 0x39, 0x01, 0xE0, 0x13, 0x02, 0xE0, 0x22,
+  0x1A, 0xE0, 0x40, 0x20, 0xE0, 0x40, 0x1A, 0xE0, 0x22, 0x02, 0xE0, 0x13,
+  0x01, 0xE0, 0x13, 0x02, 0xE0, 0x22, 0x1A, 0xE0, 0x40, 0x20, 0xE0, 0x40,
+  0x1A, 0xE3, 0x2C, 0x01, 0xE0, 0x90, 0x5C, 0x0E, 0x16, 0x07, 0xE0, 0x4E,
+  0x22, 0x4F, 0xE0, 0x6F, 0x07, 0x0A, 0x02, 0x60, 0xFF, 0x54, 0x00, 0x05,
+  0x01, 0xE0, 0x0B, 0x07, 0xE3, 0x0A, 0x02, 0xE0, 0x0A, 0x07, 0xE3, 0x0B,
+  0x01, 0xE0, 0x0C, 0x06, 0xE0, 0x37, 0x09, 0xE6, 0x37, 0x06, 0xE0, 0x0C,
+  0x01, 0xE0, 0x91, 0x92, 0xE0, 0x6C, 0x35, 0xE4, 0xFF, 0x50, 0x52, 0x85,
+  0x70, 0x6A, 0x0E, 0x5C, 0x90, 0x01, 0xE0, 0x0B, 0x07, 0xE0, 0x70, 0xE0,
+  0x93, 0xE0, 0x54, 0xFF, 0x4A, 0x28, 0xFF, 0x93, 0xE0, 0x70, 0xE0, 0x07,
+  0xE0, 0x0B, 0x01, 0xE0, 0x2C, 0x1A, 0xE9, 0x22, 0x02, 0xE0, 0x13, 0x01,
+  0xE0, 0x0B, 0x07, 0x16, 0x02, 0xE0, 0x3C, 0xE0, 0x0A, 0x07, 0xE5, 0x0B,
+  0x01, 0xE0, 0x0B, 0x07, 0xE1, 0x94, 0xE0, 0x95, 0x96, 0x71, 0x4F, 0x3D,
+  0xE0, 0x07, 0xE1, 0x0B, 0x01, 0xE0, 0x12, 0x10, 0x06, 0x16, 0x07, 0xE6,
+  0x16, 0x06, 0x10, 0x12, 0x01, 0xE0, 0x39, 0x20, 0x0E, 0x23, 0x07, 0xE0,
+  0x23, 0x0E, 0x20, 0x40, 0x1A, 0xE3, 0x2C, 0x01, 0xE0, 0x12, 0x10, 0x06,
+  0x16, 0x07, 0xE3, 0x0A, 0x3C, 0x71, 0xFF, 0x4A, 0x8A, 0x85, 0x60, 0xFF,
+  0x54, 0xA8, 0xA1, 0xFF, 0xFF, 0x01, 0x05, 0x01, 0xE0, 0x39, 0x20, 0x0E,
+  0x23, 0x07, 0xE0, 0x23, 0x0E, 0x97, 0x54, 0x72, 0x44, 0x3D, 0x07, 0xE0,
+  0x0B, 0x01, 0xE0, 0x12, 0x10, 0x06, 0x16, 0xFF, 0x4A, 0x14, 0x05, 0x1A,
+  0xFF, 0x4A, 0x81, 0xFF, 0xFF, 0x52, 0xA8, 0x15, 0xFF, 0x54, 0x2A, 0x85,
+  0xFF, 0xFF, 0x42, 0xA1, 0x5D, 0xFF, 0x50, 0x14, 0xA1, 0x16, 0x06, 0x10,
+  0x12, 0x01, 0xE0, 0x13, 0x02, 0xE0, 0x5B, 0x09, 0xE9, 0x0D, 0x01, 0xE0,
+  0x0B, 0x07, 0xE9, 0x16, 0x06, 0x10, 0x12, 0x01, 0xE0, 0x0B, 0x07, 0xE7,
+  0x16, 0x25, 0x06, 0x10, 0x09, 0x0D, 0x01, 0xE0, 0x0B, 0x07, 0xE2, 0x0A,
+  0x3C, 0xE4, 0x02, 0x06, 0x25, 0x5A, 0x01, 0xE0, 0x0B, 0x07, 0xE2, 0x25,
+  0x10, 0x09, 0xE0, 0x10, 0x25, 0x07, 0xE2, 0x0B, 0x01, 0xE0, 0x0B, 0x07,
+  0xE3, 0x16, 0x06, 0x10, 0x09, 0xE4, 0x0D, 0x01, 0xE0, 0x13, 0x02, 0xE0,
+  0x3F, 0x5D, 0x6E, 0x38, 0x26, 0x2B, 0x3B, 0x6D, 0x1A, 0x22, 0x02, 0xE0,
+  0x13, 0x01, 0xE1, 0x61, 0x4D, 0xE0, 0x62, 0x09, 0xE5, 0x62, 0x4D, 0xE0,
+  0x61, 0x01, 0xE2, 0x2C, 0x1A, 0x6D, 0x36, 0x3B, 0x27, 0x2B, 0x09, 0x26,
+  0x34, 0x38, 0x35, 0xE0, 0x5E, 0x01, 0xE1, 0x63, 0x4B, 0xE0, 0x4C, 0x09,
+  0xE5, 0x4C, 0x4B, 0xE0, 0x63, 0x01, 0xE1, 0x0D, 0x09, 0x10, 0x25, 0x68,
+  0x67, 0x01, 0xE7, 0x01, 0xEB, 0x98, 0x99, 0xE0, 0x98, 0x01, 0x01, 0x2C,
+  0x1A, 0x36, 0x27, 0x09, 0x0D, 0x01, 0xE9, 0x01, 0xE4, 0x12, 0x10, 0x06,
+  0x16, 0x07, 0x0A, 0x02, 0xE0, 0x0A, 0x07, 0xE0, 0x0B, 0x01, 0xE4, 0x3E,
+  0x0E, 0x02, 0x0A, 0xE0, 0x0E, 0xE0, 0x0A, 0xE0, 0x02, 0x0E, 0x3E, 0x01,
+  0xE4, 0x0C, 0x06, 0x02, 0x0A, 0x4E, 0x1A, 0xE0, 0x4E, 0x0A, 0x02, 0x06,
+  0x0C, 0x01, 0xE4, 0x39, 0x20, 0x0E, 0x23, 0x07, 0xE2, 0x23, 0x0E, 0x20,
+  0x39, 0x01, 0xE4, 0x13, 0x02, 0xE0, 0x22, 0x40, 0x20, 0xE0, 0x40, 0x22,
+  0x02, 0xE0, 0x13, 0x01, 0xE4, 0x13, 0x02, 0xE0, 0x22, 0x5F, 0x0E, 0xE0,
+  0x5F, 0x1A, 0xE1, 0x2C, 0x01, 0xE4, 0x0C, 0x06, 0x02, 0x9A, 0xFF, 0x4A,
+  0x10, 0x05, 0x4F, 0xE0, 0x6F, 0x9A, 0x02, 0x06, 0x0C, 0x01, 0xE4, 0x0B,
+  0x07, 0xE1, 0x0A, 0x02, 0xE0, 0x0A, 0x07, 0xE1, 0x0B, 0x01, 0xE4, 0x12,
+  0x10, 0xE0, 0x09, 0xE4, 0x10, 0xE0, 0x12, 0x01, 0xE4, 0x91, 0x92, 0xE0,
+  0x6C, 0x35, 0xE1, 0xFF, 0x54, 0x12, 0x85, 0x25, 0x06, 0x10, 0x12, 0x01,
+  0xE4, 0x0B, 0x07, 0x3D, 0x44, 0x72, 0x54, 0xE0, 0x20, 0x44, 0x3D, 0x07,
+  0x0B, 0x01, 0xE4, 0x2C, 0x1A, 0xE5, 0x22, 0x02, 0xE0, 0x13, 0x01, 0xE4,
+  0x0B, 0x07, 0x16, 0x02, 0x3C, 0xE0, 0x0A, 0x07, 0xE2, 0x0B, 0x01, 0xE4,
+  0x0B, 0x07, 0xE0, 0x94, 0x95, 0x96, 0x71, 0x4F, 0x3D, 0x07, 0xE0, 0x0B,
+  0x01, 0xE4, 0x0C, 0x06, 0x02, 0x0A, 0x07, 0xE2, 0x0A, 0x02, 0x06, 0x0C,
+  0x01, 0xE4, 0x3E, 0x0E, 0x02, 0x0A, 0xE0, 0x02, 0x0E, 0x5F, 0x1A, 0xE1,
+  0x2C, 0x01, 0xE4, 0x0C, 0x06, 0x02, 0x0A, 0x07, 0xE0, 0x6F, 0x4F, 0x44,
+  0x02, 0x84, 0x85, 0x01, 0xE4, 0x3E, 0x0E, 0x02, 0x0A, 0xE0, 0x0E, 0x97,
+  0x72, 0x44, 0x3D, 0x07, 0x0B, 0x01, 0xE4, 0x0C, 0x06, 0x02, 0x0A, 0x22,
+  0x0E, 0x60, 0x3F, 0x0A, 0x02, 0x06, 0x0C, 0x01, 0xE4, 0x13, 0x02, 0xE0,
+  0x5B, 0x09, 0xE5, 0x0D, 0x01, 0xE4, 0x0B, 0x07, 0xE5, 0x0A, 0x02, 0x06,
+  0x0C, 0x01, 0xE4, 0x0B, 0x07, 0xE4, 0x16, 0x06, 0x10, 0x09, 0x0D, 0x01,
+  0xE4, 0x0B, 0x07, 0xE2, 0x0A, 0x3C, 0xE0, 0x02, 0x06, 0x25, 0x5A, 0x01,
+  0xE4, 0x0B, 0x07, 0x16, 0x06, 0x10, 0x09, 0xE0, 0x10, 0x06, 0x16, 0x07,
+  0x0B, 0x01, 0xE4, 0x0B, 0x07, 0xE1, 0x16, 0x06, 0x10, 0x09, 0xE2, 0x0D,
+  0x01, 0xE4, 0x13, 0x02, 0xE0, 0xFF, 0x50, 0x02, 0xA1, 0x38, 0x26, 0x2B,
+  0x3B, 0xFF, 0x4A, 0x80, 0x05, 0x02, 0xE0, 0x13, 0x01, 0xE1, 0x61, 0x4D,
+  0xE0, 0x62, 0x09, 0xE0, 0x2B, 0x3B, 0x2B, 0x09, 0xE0, 0x62, 0x4D, 0xE0,
+  0x61, 0x01, 0xE1, 0x0D, 0x09, 0xEB, 0x0D, 0x01, 0xE1, 0x63, 0x4B, 0xE0,
+  0x4C, 0x09, 0xE0, 0x26, 0x38, 0x26, 0x09, 0xE0, 0x4C, 0x4B, 0xE0, 0x63,
+  0x01, 0xE7, 0xFF, 0x54, 0x05, 0xFF, 0xFF, 0x52, 0xA1, 0x45, 0xFF, 0x4A,
+  0xA8, 0x21, 0xFF, 0x48, 0x2A, 0xA1, 0xFF, 0x51, 0x4A, 0x85, 0x8B, 0x01,
+  0xE1, 0x01, 0xF0, 0xFF, 0x56, 0x80, 0x82, 0xFF, 0x58, 0x00, 0x00, 0xFF,
+  0x58, 0x0A, 0x00, 0xFF, 0x60, 0x0A, 0x00, 0x9B, 0xE1, 0xFF, 0x00, 0x09,
+  0x60, 0xFF, 0x00, 0x09, 0x5A, 0xFF, 0x00, 0x09, 0xFF, 0xE4, 0xFF, 0x00,
+  0x09, 0x6A, 0x9B, 0xE0, 0xFF, 0x80, 0x00, 0x26, 0xE0, 0xFF, 0xA0, 0x00,
+  0x95, 0xE1, 0xFF, 0x98, 0x00, 0x26, 0xE1, 0xFF, 0x58, 0x00, 0x28, 0xFF,
+  0x56, 0x00, 0x08, 0x73, 0xE1, 0xFF, 0xFF, 0x80, 0x00, 0x9C, 0xE0, 0x9D,
+  0xE0, 0xFF, 0x00, 0x96, 0x80, 0x9E, 0xFF, 0x82, 0x58, 0x0A, 0xFF, 0x82,
+  0x60, 0x0A, 0xFF, 0x82, 0x80, 0x09, 0xFF, 0x09, 0x80, 0x09, 0xE0, 0xFF,
+  0x0A, 0x00, 0x09, 0xFF, 0x26, 0x00, 0x09, 0xE1, 0xFF, 0x96, 0x00, 0x09,
+  0xE1, 0xFF, 0x56, 0x00, 0x09, 0xE0, 0xFF, 0xFF, 0x80, 0x09, 0xE0, 0xFF,
+  0x82, 0x60, 0x00, 0x24, 0x9E, 0xE0, 0x74, 0xE1, 0xFF, 0x60, 0x98, 0x00,
+  0xFF, 0x5A, 0x58, 0x00, 0x9F, 0xE4, 0xFF, 0xAA, 0x98, 0x00, 0x74, 0xE0,
+  0xFF, 0x09, 0xFF, 0x56, 0xFF, 0x09, 0xFF, 0x58, 0xFF, 0x25, 0xFF, 0x60,
+  0xFF, 0x25, 0xFF, 0x80, 0xE0, 0xA0, 0xE1, 0xFF, 0x25, 0x58, 0x00, 0xE5,
+  0xA0, 0xFF, 0x25, 0xAA, 0x00, 0xFF, 0x26, 0x02, 0x00, 0xA1, 0xA2, 0xA3,
+  0xA4, 0xE0, 0xA5, 0xE1, 0xFF, 0x25, 0x80, 0x02, 0xE5, 0xA5, 0xE1, 0xFF,
+  0x00, 0x00, 0x02, 0x00, 0xA6, 0xFF, 0x80, 0x02, 0x60, 0xE7, 0xA6, 0xFF,
+  0x80, 0x00, 0x00, 0xA7, 0xFF, 0x80, 0x02, 0xA9, 0xA8, 0xE0, 0xA9, 0xAA,
+  0x75, 0xAB, 0xE0, 0xFF, 0x00, 0x95, 0xFF, 0xE3, 0xAB, 0xE0, 0x75, 0xAA,
+  0xA9, 0xAC, 0xAD, 0xE0, 0xFF, 0x60, 0x09, 0x80, 0xFF, 0x60, 0x0A, 0x80,
+  0xFF, 0x58, 0x0A, 0x02, 0xFF, 0x58, 0x00, 0x09, 0xFF, 0x56, 0x80, 0x25,
+  0xFF, 0xFF, 0x6A, 0x95, 0x01, 0xE1, 0x45, 0x76, 0xE2, 0x45, 0x01, 0xE1,
+  0x9D, 0xE0, 0x9C, 0x73, 0xE0, 0xFF, 0xFF, 0xAA, 0xAA, 0x01, 0xE1, 0x46,
+  0x77, 0xE2, 0x46, 0x01, 0xE1, 0xFF, 0xFF, 0x60, 0x09, 0xE0, 0xFF, 0xFF,
+  0x58, 0x0A, 0x9F, 0xFF, 0xFF, 0x56, 0x80, 0xFF, 0xFF, 0xFF, 0x6A, 0x01,
+  0xE1, 0x45, 0x76, 0xE2, 0x45, 0x01, 0xE1, 0x74, 0xE0, 0xFF, 0x02, 0x58,
+  0x00, 0xFF, 0x09, 0x60, 0x00, 0xFF, 0x25, 0x60, 0x00, 0xFF, 0x95, 0x5A,
+  0xAA, 0x01, 0xE1, 0x46, 0x77, 0xE2, 0x46, 0x01, 0xE1, 0xFF, 0x26, 0x02,
+  0x80, 0xE0, 0xFF, 0x28, 0x02, 0x60, 0xFF, 0x00, 0x09, 0x58, 0xFF, 0x00,
+  0x09, 0x56, 0xFF, 0xAA, 0xA5, 0xFF, 0x01, 0xE1, 0x45, 0x76, 0xE2, 0x45,
+  0x01, 0xE1, 0xA4, 0xE0, 0xA3, 0xA2, 0xA1, 0xFF, 0x6A, 0x95, 0xFF, 0x01,
+  0xE1, 0x46, 0x77, 0xE2, 0x46, 0x01, 0xE1, 0xA8, 0xE1, 0xFF, 0x00, 0x00,
+  0x95, 0xE0, 0xFF, 0xAA, 0xAA, 0xFF, 0xAE, 0xAF, 0xE0, 0xB0, 0x73, 0xE2,
+  0xB0, 0xAF, 0xE0, 0xAE, 0xB1, 0xA7, 0xE2, 0xB1, 0xAD, 0xE0, 0xAC, 0xB2,
+  0x75, 0xE2, 0xB2, 0x01, 0xE1, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xE2, 0x08, 0xE7, 0x00, 0xE0, 0x08, 0xE0, 0x00,
+  0x00, 0xE1, 0x78, 0x17, 0xFF, 0x02, 0x80, 0xA0, 0xFF, 0x00, 0x80, 0x20,
+  0xE0, 0x78, 0x00, 0xE7, 0x00, 0xE4, 0x28, 0xE0, 0x04, 0xE0, 0x28, 0xE0,
+  0x04, 0xE0, 0x28, 0xE0, 0x00, 0xE0, 0x00, 0xE2, 0x08, 0xE0, 0x05, 0x04,
+  0x41, 0xB3, 0x05, 0xFF, 0x00, 0x28, 0xA0, 0x41, 0x04, 0x05, 0x08, 0xE0,
+  0x00, 0x00, 0xE2, 0x42, 0xE0, 0x2D, 0x31, 0x2E, 0x08, 0x2F, 0x24, 0x43,
+  0x32, 0x50, 0x42, 0xE0, 0x00, 0x00, 0xE2, 0x2F, 0x79, 0xB4, 0xFF, 0x02,
+  0x02, 0x00, 0xFF, 0x02, 0x82, 0x00, 0xB4, 0x2F, 0xFF, 0x02, 0xAA, 0x20,
+  0xB5, 0x47, 0x42, 0xB5, 0xB6, 0x00, 0x00, 0xE1, 0xB7, 0x2E, 0x31, 0xFF,
+  0x00, 0x02, 0x00, 0xE0, 0xB7, 0x00, 0xE7, 0x00, 0xE2, 0x29, 0x3A, 0x31,
+  0x08, 0xE5, 0x31, 0x3A, 0x29, 0x00, 0x00, 0xE2, 0x32, 0x24, 0x08, 0x31,
+  0xE5, 0x08, 0x24, 0x32, 0x00, 0x00, 0xE1, 0xB8, 0x08, 0x05, 0x08, 0xB8,
+  0x00, 0xE8, 0x00, 0xE7, 0x08, 0xE0, 0x05, 0xE0, 0x08, 0xE0, 0x00, 0xE1,
+  0x00, 0xEB, 0x08, 0xE0, 0x24, 0x32, 0x00, 0x00, 0xE9, 0x05, 0xE0, 0x00,
+  0xE3, 0x00, 0xED, 0x08, 0xE0, 0x00, 0x00, 0xE2, 0x3A, 0xE0, 0x2D, 0x31,
+  0x2E, 0x08, 0x2F, 0x24, 0x43, 0x32, 0x50, 0x11, 0xE0, 0x00, 0x00, 0xE5,
+  0x05, 0x04, 0x03, 0xE4, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x08, 0x2F, 0x48,
+  0x08, 0xE3, 0x05, 0xE0, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03, 0x18, 0x2D,
+  0x2E, 0x2F, 0x43, 0x04, 0xE0, 0x00, 0x00, 0xE5, 0x0F, 0x04, 0x29, 0xE0,
+  0xFF, 0x00, 0xAA, 0x80, 0xE0, 0x29, 0xE0, 0x04, 0x0F, 0x00, 0x00, 0xE5,
+  0x2D, 0x49, 0xFF, 0x00, 0xA2, 0x80, 0x28, 0x42, 0x04, 0xE0, 0x3A, 0xE1,
+  0x00, 0x00, 0xE5, 0x04, 0xE0, 0x11, 0x0F, 0x04, 0x29, 0xE0, 0x03, 0x04,
+  0x05, 0x00, 0x00, 0xE5, 0x05, 0x0F, 0x11, 0xE0, 0x0F, 0x04, 0x03, 0xE0,
+  0x04, 0x05, 0x00, 0x00, 0xE5, 0x04, 0xE0, 0x29, 0x51, 0x2D, 0x2E, 0x08,
+  0xE2, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03, 0xE0, 0x05, 0xE0, 0x03, 0xE0,
+  0x04, 0x05, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03, 0xE0, 0x04, 0x64, 0x29,
+  0xE0, 0x04, 0x0F, 0x00, 0x00, 0xE6, 0x08, 0xE0, 0x00, 0xE2, 0x08, 0xE0,
+  0x00, 0xE0, 0x00, 0xE6, 0x08, 0xE0, 0x00, 0xE2, 0x08, 0xE0, 0x24, 0x00,
+  0x00, 0xE5, 0x3A, 0x31, 0x08, 0x24, 0x32, 0xE0, 0x24, 0x08, 0x31, 0x3A,
+  0x00, 0x00, 0xE7, 0x05, 0xE0, 0x00, 0xE0, 0x05, 0xE0, 0x00, 0xE1, 0x00,
+  0xE5, 0x11, 0x32, 0x24, 0x08, 0x31, 0xE0, 0x08, 0x24, 0x32, 0x11, 0x00,
+  0x00, 0xE2, 0x05, 0x04, 0x03, 0xE0, 0x29, 0x51, 0x2D, 0x2E, 0x08, 0x00,
+  0xE0, 0x08, 0xE0, 0x00, 0x00, 0xE2, 0x05, 0x03, 0xFF, 0x28, 0x00, 0x28,
+  0xFF, 0x20, 0x00, 0x08, 0x8D, 0x8E, 0xE0, 0x8F, 0xFF, 0x20, 0xA8, 0xA0,
+  0xFF, 0x20, 0x00, 0x00, 0xFF, 0x28, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00,
+  0xE1, 0x14, 0x05, 0x17, 0x03, 0xE3, 0x04, 0xE0, 0x03, 0xE2, 0x00, 0x00,
+  0xE1, 0x21, 0x0F, 0x18, 0x03, 0xE0, 0x18, 0x0F, 0xE0, 0x18, 0x03, 0xE0,
+  0x18, 0x0F, 0x21, 0x00, 0x00, 0xE1, 0x14, 0x05, 0x17, 0x03, 0x11, 0xE4,
+  0x03, 0x17, 0x05, 0x14, 0x00, 0x00, 0xE1, 0x21, 0x0F, 0x18, 0x03, 0xE6,
+  0x18, 0x0F, 0x21, 0x00, 0x00, 0xE1, 0x04, 0xE0, 0x11, 0xE2, 0x21, 0xE0,
+  0x11, 0xE2, 0x04, 0xE0, 0x00, 0x00, 0xE1, 0x04, 0xE0, 0x11, 0xE2, 0x21,
+  0xE0, 0x11, 0xE4, 0x00, 0x00, 0xE1, 0x79, 0x0F, 0x17, 0x03, 0xE0, 0x11,
+  0xE0, 0x52, 0xE0, 0x03, 0xE1, 0x04, 0x64, 0x00, 0x00, 0xE1, 0x03, 0xE4,
+  0x04, 0xE0, 0x03, 0xE4, 0x00, 0x00, 0xE1, 0x05, 0xE0, 0x08, 0xE8, 0x05,
+  0xE0, 0x00, 0x00, 0xE1, 0xB9, 0xE0, 0x3A, 0xE6, 0x42, 0xE0, 0x0F, 0x79,
+  0x00, 0x00, 0xE1, 0x03, 0xE0, 0x42, 0xE0, 0xBA, 0xE0, 0x65, 0xB3, 0xBA,
+  0xE0, 0x42, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0xE1, 0x11, 0xEA, 0x04, 0xE0,
+  0x00, 0x00, 0xE1, 0x03, 0x17, 0x04, 0xE0, 0x41, 0xE0, 0x03, 0xE6, 0x00,
+  0x00, 0xE1, 0x03, 0xE1, 0x66, 0xE0, 0xBB, 0xBC, 0x7A, 0x52, 0x18, 0xE0,
+  0x03, 0xE1, 0x00, 0x00, 0xE1, 0x14, 0x05, 0x17, 0x03, 0xE6, 0x17, 0x05,
+  0x14, 0x00, 0x00, 0xE1, 0x21, 0x0F, 0x18, 0x03, 0xE0, 0x18, 0x0F, 0x21,
+  0x11, 0xE4, 0x00, 0x00, 0xE1, 0x14, 0x05, 0x17, 0x03, 0xE4, 0x41, 0x7A,
+  0xFF, 0x0A, 0x8A, 0x80, 0x64, 0xFF, 0x00, 0xA8, 0xA0, 0x00, 0x00, 0xE1,
+  0x21, 0x0F, 0x18, 0x03, 0xE0, 0x18, 0x0F, 0x65, 0xE0, 0x7B, 0x47, 0x18,
+  0x03, 0xE0, 0x00, 0x00, 0xE1, 0x14, 0x05, 0x17, 0x11, 0xE0, 0x50, 0x48,
+  0x49, 0x51, 0x29, 0xE0, 0x17, 0x05, 0x14, 0x00, 0x00, 0xE1, 0x04, 0xE0,
+  0x08, 0xEA, 0x00, 0x00, 0xE1, 0x03, 0xE9, 0x17, 0x05, 0x14, 0x00, 0x00,
+  0xE1, 0x03, 0xE7, 0x17, 0x28, 0x05, 0x14, 0x08, 0x00, 0x00, 0xE1, 0x03,
+  0xE3, 0x41, 0xE4, 0x04, 0x05, 0x28, 0x00, 0x00, 0xE1, 0x03, 0xE2, 0x28,
+  0x14, 0x08, 0xE0, 0x14, 0x28, 0x03, 0xE2, 0x00, 0x00, 0xE1, 0x03, 0xE3,
+  0x17, 0x05, 0x14, 0x08, 0xE4, 0x00, 0x00, 0xE1, 0x04, 0xE0, 0x29, 0xE0,
+  0x51, 0x2D, 0x2E, 0x2F, 0x43, 0x50, 0x11, 0xE0, 0x04, 0xE0, 0x00, 0x00,
+  0xE2, 0x49, 0xE0, 0x08, 0xE7, 0x49, 0xE0, 0x00, 0x00, 0xE2, 0x08, 0xEB,
+  0x00, 0x00, 0xE2, 0x48, 0xE0, 0x08, 0xE7, 0x48, 0xE0, 0x00, 0x00, 0xE2,
+  0x08, 0x14, 0x28, 0x78, 0x00, 0xE8, 0x00, 0xEC, 0x99, 0xE0, 0x00, 0xE0,
+  0x00, 0xE0, 0x11, 0x32, 0x24, 0x08, 0x00, 0xEA, 0x00, 0xE5, 0x14, 0x05,
+  0x17, 0x03, 0xE0, 0x04, 0xE0, 0x03, 0xE1, 0x00, 0x00, 0xE5, 0x0F, 0x04,
+  0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x04, 0x0F, 0x00, 0x00, 0xE5, 0x05,
+  0x04, 0x03, 0x11, 0xE2, 0x03, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x21, 0x0F,
+  0x18, 0x03, 0xE2, 0x18, 0x0F, 0x21, 0x00, 0x00, 0xE5, 0x04, 0xE0, 0x11,
+  0xE0, 0x21, 0xE0, 0x11, 0xE0, 0x04, 0xE0, 0x00, 0x00, 0xE5, 0x04, 0xE0,
+  0x11, 0xE0, 0x0F, 0xE0, 0x11, 0xE2, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x66,
+  0x11, 0x52, 0xE0, 0x03, 0x66, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x03, 0xE2,
+  0x04, 0xE0, 0x03, 0xE2, 0x00, 0x00, 0xE5, 0x14, 0xE0, 0x08, 0xE4, 0x14,
+  0xE0, 0x00, 0x00, 0xE5, 0xB9, 0xE0, 0x3A, 0xE3, 0x28, 0x05, 0x14, 0x00,
+  0x00, 0xE5, 0x03, 0x18, 0x47, 0x7B, 0x65, 0xE0, 0x21, 0x47, 0x18, 0x03,
+  0x00, 0x00, 0xE5, 0x11, 0xE6, 0x04, 0xE0, 0x00, 0x00, 0xE5, 0x03, 0x17,
+  0x04, 0x41, 0xE0, 0x03, 0xE3, 0x00, 0x00, 0xE5, 0x03, 0xE0, 0x66, 0xBB,
+  0xBC, 0x7A, 0x52, 0x18, 0x03, 0xE0, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03,
+  0xE4, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x0F, 0x04, 0x03, 0xE0, 0x04, 0x0F,
+  0x11, 0xE2, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03, 0xE2, 0x52, 0x47, 0x04,
+  0xB6, 0x00, 0x00, 0xE5, 0x0F, 0x04, 0x03, 0xE0, 0x0F, 0x65, 0x7B, 0x47,
+  0x18, 0x03, 0x00, 0x00, 0xE5, 0x05, 0x04, 0x03, 0x11, 0x0F, 0x64, 0x29,
+  0x03, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x04, 0xE0, 0x08, 0xE6, 0x00, 0x00,
+  0xE5, 0x03, 0xE6, 0x04, 0x05, 0x00, 0x00, 0xE5, 0x03, 0xE4, 0x17, 0x05,
+  0x14, 0x08, 0x00, 0x00, 0xE5, 0x03, 0xE3, 0x41, 0xE0, 0x04, 0x05, 0x28,
+  0x00, 0x00, 0xE5, 0x03, 0x17, 0x05, 0x14, 0x08, 0xE0, 0x14, 0x05, 0x17,
+  0x03, 0x00, 0x00, 0xE5, 0x03, 0xE1, 0x17, 0x05, 0x14, 0x08, 0xE2, 0x00,
+  0x00, 0xE5, 0x04, 0xE0, 0x51, 0x2D, 0x2E, 0x2F, 0x43, 0x50, 0x04, 0xE0,
+  0x00, 0x00, 0xE2, 0x49, 0x08, 0xE2, 0x2F, 0x43, 0x2F, 0x08, 0xE2, 0x49,
+  0x00, 0x00, 0xE2, 0x08, 0xEB, 0x00, 0x00, 0xE2, 0x48, 0xE0, 0x08, 0xE1,
+  0x2E, 0x2D, 0x2E, 0x08, 0xE1, 0x48, 0xE0, 0x00, 0x00, 0xE8, 0x43, 0xFF,
+  0x0A, 0xA8, 0x20, 0xFF, 0x08, 0x2A, 0xA0, 0x2D, 0x00, 0xE2, 0x00, 0xF0
+};
+
+#endif /* FONT_H */
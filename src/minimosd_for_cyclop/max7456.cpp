@@ -43,10 +43,10 @@ void Max7456::setBlinkParams(byte blinkBase, byte blinkDC)
 {
   _regVm1.bits.blinkingTime = blinkBase;
   _regVm1.bits.blinkingDutyCycle = blinkDC;
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(VM1_ADDRESS_WRITE);
-  SPI.transfer(_regVm1.byte);
-  digitalWrite(_pinCS, HIGH);
+  select();
+  transfer(VM1_ADDRESS_WRITE);
+  transfer(_regVm1.byte);
+  deselect();
 }
 
 /******************************************************************************
@@ -54,19 +54,16 @@ void Max7456::setBlinkParams(byte blinkBase, byte blinkDC)
  ******************************************************************************/
 void Max7456::setDisplayOffsets(byte horizontal, byte vertical)
 {
-  digitalWrite(_pinCS, LOW);
+  select();
   _regHos.byte = 0;
   _regHos.bits.horizontalPositionOffset = horizontal;
-  SPI.transfer(HOS_ADDRESS_WRITE);
-  SPI.transfer(_regHos.byte);
-  digitalWrite(_pinCS, HIGH);
-
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(VOS_ADDRESS_WRITE);
+  transfer(HOS_ADDRESS_WRITE);
+  transfer(_regHos.byte);
+  transfer(VOS_ADDRESS_WRITE);
   _regVos.byte = 0;
   _regVos.bits.verticalPositionOffset = vertical;
-  SPI.transfer(_regVos.byte);
-  digitalWrite(_pinCS, HIGH);
+  transfer(_regVos.byte);
+  deselect();
 }
 
 /******************************************************************************
@@ -81,30 +78,35 @@ Max7456::Max7456()
  ******************************************************************************/
 void Max7456::sendCharacter(const charact chara, byte pos)
 {
+  startSendCharacter(chara, pos);
+  waitReady();
+}
+
+/******************************************************************************
+   Function: Max7456::startSendCharacter
+ ******************************************************************************/
+void Max7456::startSendCharacter(const charact chara, byte pos)
+{
+  waitReady();
   activateOSD(false);
   //datasheet p38
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(CMAH_ADDRESS_WRITE);
-  SPI.transfer(pos);
+  select();
+  transfer(CMAH_ADDRESS_WRITE);
+  transfer(pos);
 
   for (byte i = 0 ; i < 54 ; i++)
   {
-    SPI.transfer(CMAL_ADDRESS_WRITE);
-    SPI.transfer(i);
-    SPI.transfer(CMDI_ADDRESS_WRITE);
-    SPI.transfer(chara[i]);
+    transfer(CMAL_ADDRESS_WRITE);
+    transfer(i);
+    transfer(CMDI_ADDRESS_WRITE);
+    transfer(chara[i]);
   }
   _regCmm.byte = 0xA0; //To write the NVM array
-  SPI.transfer(CMM_ADDRESS_WRITE);
-  SPI.transfer(_regCmm.byte);
-  //while STAT[5] is not good, we wait.
-  _regStat.bits.characterMemoryStatus = 1;
-  while (  _regStat.bits.characterMemoryStatus == 1)
-  {
-    SPI.transfer(STAT_ADDRESS_READ);
-    _regStat.byte = SPI.transfer(0x00);
-  }
-  digitalWrite(_pinCS, HIGH);
+  transfer(CMM_ADDRESS_WRITE);
+  transfer(_regCmm.byte);
+  deselect();
+  // STAT[5] is set until the NVM write is done, see poll()
+  _nvmBusy = true;
 }
 
 /******************************************************************************
@@ -119,78 +121,79 @@ void Max7456::getCharacter(charact chara, byte x, byte y)
   else
     charAddress = x + y * 16;
 
+  waitReady();
   activateOSD(false);
   //datasheet p38
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(CMAH_ADDRESS_WRITE);
-  SPI.transfer(charAddress);
+  select();
+  transfer(CMAH_ADDRESS_WRITE);
+  transfer(charAddress);
   _regCmm.byte = 0x50; //To read from the NVM array
-  SPI.transfer(CMM_ADDRESS_WRITE);
-  SPI.transfer(_regCmm.byte);
+  transfer(CMM_ADDRESS_WRITE);
+  transfer(_regCmm.byte);
 
   for (byte i = 0 ; i < 54 ; i++)
   {
-    SPI.transfer(CMAL_ADDRESS_WRITE);
-    SPI.transfer(i);
-    SPI.transfer(CMDO_ADDRESS_READ); //read from device through spi
-    chara[i] = SPI.transfer(0x00);
+    transfer(CMAL_ADDRESS_WRITE);
+    transfer(i);
+    transfer(CMDO_ADDRESS_READ); //read from device through spi
+    chara[i] = transfer(0x00);
   }
-  digitalWrite(_pinCS, HIGH);
+  deselect();
 }
 /******************************************************************************
    Function: Max7456::printCharacterToSerial
  ******************************************************************************/
-void Max7456::printCharacterToSerial(const charact array, bool img)
+void Max7456::printCharacterToSerial(const charact array, Print &serial, bool img)
 {
   if (img)
   {
     CARACT car ;
     car = Max7456::byteArray2CARACT(array);
 
-    Serial.println("------------");
+    serial.println("------------");
     for (int i = 0 ; i < 18 ; i++)
     {
       for (int j = 0 ; j < 3 ; j++)
       {
-        printPixel(car.line[i].pixels[j].pix0);
-        printPixel(car.line[i].pixels[j].pix1);
-        printPixel(car.line[i].pixels[j].pix2);
-        printPixel(car.line[i].pixels[j].pix3);
+        printPixel(serial, car.line[i].pixels[j].pix0);
+        printPixel(serial, car.line[i].pixels[j].pix1);
+        printPixel(serial, car.line[i].pixels[j].pix2);
+        printPixel(serial, car.line[i].pixels[j].pix3);
       }
-      Serial.println("");
+      serial.println("");
     }
-    Serial.println("------------");
+    serial.println("------------");
   }
   else
   {
-    Serial.print("{");
+    serial.print("{");
     for (unsigned int i = 0 ; i < 53 ; i++)
     {
-      Serial.print("0x");
-      Serial.print(String(array[i], HEX));
-      Serial.print(", ");
+      serial.print("0x");
+      serial.print(String(array[i], HEX));
+      serial.print(", ");
     }
-    Serial.print("0x");
-    Serial.print(String(array[53], HEX));
-    Serial.println("};");
+    serial.print("0x");
+    serial.print(String(array[53], HEX));
+    serial.println("};");
   }
 }
 
 /******************************************************************************
    Function: Max7456::Max7456
  ******************************************************************************/
-void Max7456::printPixel(byte value)
+void Max7456::printPixel(Print &serial, byte value)
 {
   switch (value )
   {
     case COLOR_BLACK :
-      Serial.print("#");
+      serial.print("#");
       return;
     case COLOR_WHITE :
-      Serial.print("*");
+      serial.print("*");
       return;
     default:
-      Serial.print(" ");
+      serial.print(" ");
       return;
   }
 }
@@ -200,33 +203,35 @@ void Max7456::printPixel(byte value)
  ******************************************************************************/
 void Max7456::print(const char string[], byte x, byte y, byte blink, byte inv)
 {
-  char          currentChar;
-  byte          size;
-  byte *chars = NULL;
-
   if (!string) return;
 
-  size = 0;
-  currentChar = string[0];
+  beginDisplayWrite(x, y, blink, inv);
+  while (*string)
+    writeDisplayByte(*string++);
+  endDisplayWrite();
+}
 
-  while (currentChar != '\0')
-  {
-    currentChar = string[++size];
-  }
-  chars = (byte*) malloc(size * sizeof(byte));
+/******************************************************************************
+   Function: Max7456::print
+ ******************************************************************************/
+void Max7456::print(const __FlashStringHelper *string, byte x, byte y, byte blink, byte inv)
+{
+  const char *p = (const char *)string;
+  char c;
 
-  for (byte i = 0 ; i < size ; i++)
-  {
-    chars[i] = string[i];
-  }
-  printMax7456Chars(chars, size, x,  y,  blink , inv );
-  free(chars);
+  if (!p) return;
+
+  beginDisplayWrite(x, y, blink, inv);
+  while ((c = pgm_read_byte_near(p++)))
+    writeDisplayByte(c);
+  endDisplayWrite();
 }
 
 void Max7456::printMax7456Char(const byte address, byte x, byte y, byte blink, byte inv)
 {
-  byte ad = address;
-  printMax7456Chars(&ad, 1, x, y, blink, inv);
+  beginDisplayWrite(x, y, blink, inv);
+  writeDisplayByte(address);
+  endDisplayWrite();
 }
 
 /******************************************************************************
@@ -234,72 +239,115 @@ void Max7456::printMax7456Char(const byte address, byte x, byte y, byte blink, b
  ******************************************************************************/
 void Max7456::printMax7456Chars(byte chars[], byte size, byte x, byte y, byte blink , byte inv )
 {
-  byte          currentCharMax7456;
-  byte          posAddressLO;
-  byte          posAddressHI;
+  beginDisplayWrite(x, y, blink, inv);
+  for (int i = 0; i < size ; i++)
+    writeDisplayByte(chars[i]);
+  endDisplayWrite();
+}
+
+/******************************************************************************
+   Function: Max7456::beginDisplayWrite
+             Selects the device and sets up an auto-increment write to the
+             display memory at x, y
+ ******************************************************************************/
+void Max7456::beginDisplayWrite(byte x, byte y, byte blink, byte inv)
+{
   unsigned int  posAddress;
 
   posAddress = 30 * y + x;
 
-  posAddressHI = posAddress >> 8;
-  posAddressLO = posAddress;
+  waitReady();
 
   _regDmm.byte = 0x01;
 
   _regDmm.bits.INV = inv;
   _regDmm.bits.BLK = blink;
 
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(DMM_ADDRESS_WRITE);
-  SPI.transfer(_regDmm.byte);
-
-  SPI.transfer(DMAH_ADDRESS_WRITE); // set start address high
-  SPI.transfer(posAddressHI);
+  select();
+  transfer(DMM_ADDRESS_WRITE);
+  transfer(_regDmm.byte);
 
-  SPI.transfer(DMAL_ADDRESS_WRITE); // set start address low
-  SPI.transfer(posAddressLO);
+  transfer(DMAH_ADDRESS_WRITE); // set start address high
+  transfer(posAddress >> 8);
 
-  for (int i = 0; i < size ; i++)
-  {
-    currentCharMax7456 = chars[i];
-    SPI.transfer(DMDI_ADDRESS_WRITE);
-    SPI.transfer(currentCharMax7456);
-  }
-  //end character (we're done).
-  SPI.transfer(DMDI_ADDRESS_WRITE);
-  SPI.transfer(0xff);
-  digitalWrite(_pinCS, HIGH);
+  transfer(DMAL_ADDRESS_WRITE); // set start address low
+  transfer(posAddress & 0xFF);
 }
 
 /******************************************************************************
-   Function: Max7456::print
+   Function: Max7456::writeDisplayByte
  ******************************************************************************/
+void Max7456::writeDisplayByte(byte c)
+{
+  transfer(DMDI_ADDRESS_WRITE);
+  transfer(c);
+}
 
-void Max7456::print(double value, byte x, byte y, byte before, byte after, byte blink, byte inv)
+/******************************************************************************
+   Function: Max7456::endDisplayWrite
+ ******************************************************************************/
+void Max7456::endDisplayWrite(void)
 {
-  char *strValue = NULL;
+  //end character (we're done).
+  transfer(DMDI_ADDRESS_WRITE);
+  transfer(0xff);
+  deselect();
+}
 
-  strValue = (char*) malloc((before + after + 2) * sizeof(char));
+/******************************************************************************
+   Function: Max7456::printFixed
+ ******************************************************************************/
+void Max7456::printFixed(long value, byte x, byte y, byte width, byte decimals, char pad, byte blink, byte inv)
+{
+  char          digits[MAX7456_NUMBER_DIGITS];
+  byte          i = sizeof(digits);
+  byte          length;
+  unsigned long absValue = value < 0 ? -(unsigned long)value : value;
 
-  if (after == 0)
-    dtostrf(value, before + after, after, strValue);
-  else
-    dtostrf(value, before + after + 1, after, strValue);
+  if (decimals > MAX7456_MAX_DECIMALS)
+    decimals = MAX7456_MAX_DECIMALS;
 
-  for (int i = 0 ; i < before + after + 1; i++)
+  // Digits are generated backwards from the end of the buffer
+  for (byte d = 0; d < decimals; d++)
   {
-    if (strValue[i] == ' ' || strValue[i] == '-')
-      strValue[i] = '0';
+    digits[--i] = '0' + absValue % 10;
+    absValue /= 10;
   }
-  if (value < 0)
-    strValue[0] = '-';
-  if (after == 0) //If the result is bigger, we truncate it so the OSD won't be falsed.
-    strValue[before] = '\0';
-  else
-    strValue[before + after + 1] = '\0';
+  if (decimals)
+    digits[--i] = '.';
+  do
+  {
+    digits[--i] = '0' + absValue % 10;
+    absValue /= 10;
+  } while (absValue);
+
+  length = sizeof(digits) - i + (value < 0 ? 1 : 0);
+
+  beginDisplayWrite(x, y, blink, inv);
+  if ((value < 0) && (pad == '0'))
+    writeDisplayByte('-');
+  for ( ; length < width; length++)
+    writeDisplayByte(pad);
+  if ((value < 0) && (pad != '0'))
+    writeDisplayByte('-');
+  for ( ; i < sizeof(digits); i++)
+    writeDisplayByte(digits[i]);
+  endDisplayWrite();
+}
+
+/******************************************************************************
+   Function: Max7456::print
+ ******************************************************************************/
 
-  print(strValue, x, y, blink, inv);
-  free(strValue);
+void Max7456::print(double value, byte x, byte y, byte before, byte after, byte blink, byte inv)
+{
+  double scale = 1;
+
+  for (byte i = 0; i < after; i++)
+    scale *= 10;
+  value *= scale;
+  printFixed((long)(value < 0 ? value - 0.5 : value + 0.5), x, y,
+             after ? before + after + 1 : before, after, '0', blink, inv);
 }
 
 /******************************************************************************
@@ -307,108 +355,225 @@ void Max7456::print(double value, byte x, byte y, byte before, byte after, byte
  ******************************************************************************/
 void Max7456::clearScreen()
 {
+  startClearScreen();
+  waitReady();
+}
 
-  digitalWrite(_pinCS, LOW);
+/******************************************************************************
+   Function: Max7456::startClearScreen
+ ******************************************************************************/
+void Max7456::startClearScreen()
+{
+  waitReady();
+  select();
   _regDmm.bits.clearDisplayMemory = 1 ;
-  SPI.transfer(DMM_ADDRESS_WRITE);
-  SPI.transfer(_regDmm.byte);
-  digitalWrite(_pinCS, HIGH);
+  transfer(DMM_ADDRESS_WRITE);
+  transfer(_regDmm.byte);
+  deselect();
+  // DMM[2] is set until the display memory is cleared, see poll()
+  _clearBusy = true;
+}
 
-  /* wait for operation to complete */
-  while (_regDmm.bits.clearDisplayMemory == 1 )
+/******************************************************************************
+   Function: Max7456::poll
+ ******************************************************************************/
+bool Max7456::poll()
+{
+  if (_clearBusy)
   {
-    digitalWrite(_pinCS, LOW);
-    SPI.transfer(DMM_ADDRESS_READ);
-    _regDmm.byte = SPI.transfer(0x00);
-    digitalWrite(_pinCS, HIGH);
+    select();
+    transfer(DMM_ADDRESS_READ);
+    _regDmm.byte = transfer(0x00);
+    deselect();
+    _clearBusy = _regDmm.bits.clearDisplayMemory;
   }
+  if (_nvmBusy && !_clearBusy)
+  {
+    select();
+    transfer(STAT_ADDRESS_READ);
+    _regStat.byte = transfer(0x00);
+    deselect();
+    _nvmBusy = _regStat.bits.characterMemoryStatus;
+  }
+  return !_clearBusy && !_nvmBusy;
+}
+
+/******************************************************************************
+   Function: Max7456::waitReady
+             Busy-waits for a started operation to complete
+ ******************************************************************************/
+void Max7456::waitReady()
+{
+  unsigned long start;
+
+  if (poll())
+    return;
+  start = micros();
+  while (!poll()) ;
+  _busyWaitTime += micros() - start;
 }
 
+/******************************************************************************
+   Register values after reset, indexed by register write address
+ ******************************************************************************/
+static constexpr byte registerDefaults[] = {
+  0b00000000,   // VM0
+  0b01000111,   // VM1
+  0b00100000,   // HOS
+  0b00010000,   // VOS
+  0b00000000,   // DMM
+  0b00000000,   // DMAH
+  0b00000000,   // DMAL
+  0b00000000,   // DMDI
+  0b00000000,   // CMM
+  0b00000000,   // CMAH
+  0b00000000,   // CMAL
+  0b00000000,   // CMDI
+  0b00011011,   // OSDM
+  0b00000000,   // Not used
+  0b00000000,   // Not used
+  0b00000000,   // Not used
+  0b00000001    // RB0 - RB15
+};
+
 /******************************************************************************
    Function: Max7456::init
  ******************************************************************************/
-void Max7456::init(byte iPinCS)
+bool Max7456::init(byte iPinCS)
 {
-  // Setup Chip Select Pin
+  // Setup Chip Select Pin. It is driven through its port register.
   _pinCS = iPinCS;
+  _csPort = portOutputRegister(digitalPinToPort(_pinCS));
+  _csMask = digitalPinToBitMask(_pinCS);
   pinMode(_pinCS, OUTPUT);
+  *_csPort |= _csMask;
 
-  // Hardware boot time (Really needed ?)
-  delay(100);
+  _spiTransactions = 0;
+  _spiBytes = 0;
+  _busTime = 0;
+  _busyWaitTime = 0;
+
+  return reinit();
+}
 
-  // Reset All registers to default and clear video memory
-  digitalWrite(_pinCS, HIGH); // Safety (Needed?)
-  digitalWrite(_pinCS, LOW);
-  _regVm0.bits.softwareResetBit = 1;
-  SPI.transfer(VM0_ADDRESS_WRITE);
-  SPI.transfer(_regVm0.byte);
-  digitalWrite(_pinCS, HIGH);
-  _regVm0.bits.softwareResetBit = 0; // he real register bit is reset automatically
+/******************************************************************************
+   Function: Max7456::reinit
+ ******************************************************************************/
+bool Max7456::reinit()
+{
+  bool ready;
 
-  // Wait for the reset to complete
-  delay(100);  // Probably to long
+  ready = reset();
 
   // Set class global variables
   _isActivatedOsd = false;
+  _clearBusy = false;
+  _nvmBusy = false;
 
   // Set shadow registers to default values
   for (int x = 0 ; x < 16 ; x++)
-    _regRb[x].byte = 0b00000001;
-
-  _regVm0.byte =   0b00000000;
-  _regVm1.byte =   0b01000111;
-  _regHos.byte =   0b00100000;
-  _regVos.byte =   0b00010000;
-  _regDmm.byte =   0b00000000;
-  _regDmah.byte =  0b00000000;
-  _regDmal.byte =  0b00000000;
-  _regDmdi.byte =  0b00000000;
-  _regCmm.byte =   0b00000000;
-  _regCmah.byte =  0b00000000;
-  _regCmal.byte =  0b00000000;
-  _regCmdi.byte =  0b00000000;
-  _regOsdm.byte =  0b00011011;
+    _regRb[x].byte = registerDefaults[RB0_ADDRESS_WRITE];
+
+  _regVm0.byte =   registerDefaults[VM0_ADDRESS_WRITE];
+  _regVm1.byte =   registerDefaults[VM1_ADDRESS_WRITE];
+  _regHos.byte =   registerDefaults[HOS_ADDRESS_WRITE];
+  _regVos.byte =   registerDefaults[VOS_ADDRESS_WRITE];
+  _regDmm.byte =   registerDefaults[DMM_ADDRESS_WRITE];
+  _regDmah.byte =  registerDefaults[DMAH_ADDRESS_WRITE];
+  _regDmal.byte =  registerDefaults[DMAL_ADDRESS_WRITE];
+  _regDmdi.byte =  registerDefaults[DMDI_ADDRESS_WRITE];
+  _regCmm.byte =   registerDefaults[CMM_ADDRESS_WRITE];
+  _regCmah.byte =  registerDefaults[CMAH_ADDRESS_WRITE];
+  _regCmal.byte =  registerDefaults[CMAL_ADDRESS_WRITE];
+  _regCmdi.byte =  registerDefaults[CMDI_ADDRESS_WRITE];
+  _regOsdm.byte =  registerDefaults[OSDM_ADDRESS_WRITE];
   _regStat.byte =  0b00000000;  // Read only, value does not matter
   _regDmdo.byte =  0b00000000;  // Read only, value does not matter
   _regCmdo.byte =  0b00000000;  // Read only, value does not matter
 
   // Fetch OSDBL register value. Bits 0-3 have no default values
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(OSDBL_ADDRESS_READ);
-  _regOsdbl.byte = SPI.transfer(0x00);
-  digitalWrite(_pinCS, HIGH);
+  _regOsdbl.byte = readRegister(OSDBL_ADDRESS_READ);
+
+  // The remaining registers are written in one burst
+  select();
 
   // Set video format and vertical write synch
-  digitalWrite(_pinCS, LOW);
   _regVm0.bits.videoSelect = 0;      //1=PAL, 0=NTSC
   _regVm0.bits.verticalSynch = 1;
-  SPI.transfer(VM0_ADDRESS_WRITE);
-  SPI.transfer(_regVm0.byte);
-  digitalWrite(_pinCS, HIGH);
+  transfer(VM0_ADDRESS_WRITE);
+  transfer(_regVm0.byte);
 
   // Set sharpness parameters
-  digitalWrite(_pinCS, LOW);
   _regOsdm.bits.osdInsertionMuxSwitchingTime = 0b010; //000= Max sharp, 111= Least sharp
   _regOsdm.bits.osdRiseAndFallTime = 0b010;           //000= Max sharp, 111= Least sharp
-  SPI.transfer(OSDM_ADDRESS_WRITE);
-  SPI.transfer(_regOsdm.byte);
-  digitalWrite(_pinCS, HIGH);
+  transfer(OSDM_ADDRESS_WRITE);
+  transfer(_regOsdm.byte);
 
   // Set row white levels
   for (int x = 0 ; x < 16 ; x++)
   {
-    digitalWrite(_pinCS, LOW);
     _regRb[x].bits.characterWhiteLevel = 0;    // 0=120%, 1=100%, 2=90%, 3=80%
-    SPI.transfer(x + RB0_ADDRESS_WRITE);
-    SPI.transfer(_regRb[x].byte);
-    digitalWrite(_pinCS, HIGH);
+    transfer(x + RB0_ADDRESS_WRITE);
+    transfer(_regRb[x].byte);
   }
   // Enable automatic OSD black level control
-  digitalWrite(_pinCS, LOW);
   _regOsdbl.bits.osdImageBlackLevelControl = 0; //0=Enable, 1=Disable
-  SPI.transfer(OSDBL_ADDRESS_WRITE);
-  SPI.transfer(_regOsdbl.byte);
-  digitalWrite(_pinCS, HIGH);
+  transfer(OSDBL_ADDRESS_WRITE);
+  transfer(_regOsdbl.byte);
+  deselect();
+
+  return ready;
+}
+
+/******************************************************************************
+   Function: Max7456::reset
+             Waits for the power-up reset to complete and makes a software
+             reset. The reset is complete when VM0[1] is cleared and VM1
+             reads its default value, which also shows that the device answers.
+ ******************************************************************************/
+bool Max7456::reset()
+{
+  unsigned long start = millis();
+  REG_STAT stat;
+  REG_VM0 vm0;
+  bool resetStarted = false;
+
+  do
+  {
+    stat.byte = readRegister(STAT_ADDRESS_READ);
+    if (!stat.bits.resetMode && !resetStarted)
+    {
+      vm0.byte = 0;
+      vm0.bits.softwareResetBit = 1;
+      select();
+      transfer(VM0_ADDRESS_WRITE);
+      transfer(vm0.byte);
+      deselect();
+      resetStarted = true;
+    }
+    else if (resetStarted)
+    {
+      vm0.byte = readRegister(VM0_ADDRESS_READ);
+      if (!vm0.bits.softwareResetBit &&
+          (readRegister(VM1_ADDRESS_READ) == registerDefaults[VM1_ADDRESS_WRITE]))
+        return true;
+    }
+  } while (millis() - start < MAX7456_RESET_TIMEOUT_MS);
+  return false;
+}
+
+/******************************************************************************
+   Function: Max7456::readRegister
+ ******************************************************************************/
+byte Max7456::readRegister(byte address)
+{
+  byte value;
+
+  select();
+  transfer(address);
+  value = transfer(0x00);
+  deselect();
+  return value;
 }
 
 /******************************************************************************
@@ -418,20 +583,20 @@ void Max7456::activateOSD(bool act)
 {
   if (_isActivatedOsd != act)
   {
-    digitalWrite(_pinCS, LOW);
+    select();
     _regVm0.bits.enableOSD = act ? 1 : 0; // Enable OSD
-    SPI.transfer(VM0_ADDRESS_WRITE);
-    SPI.transfer(_regVm0.byte);
-    digitalWrite(_pinCS, HIGH);
+    transfer(VM0_ADDRESS_WRITE);
+    transfer(_regVm0.byte);
+    deselect();
 
     // Enable automatic black level controll
     if ( act )
     {
-      digitalWrite(_pinCS, LOW);
+      select();
       _regOsdbl.bits.osdImageBlackLevelControl = 0;  // 0=Enable, 1=Disable
-      SPI.transfer(OSDBL_ADDRESS_WRITE);
-      SPI.transfer(_regOsdbl.byte);
-      digitalWrite(_pinCS, HIGH);
+      transfer(OSDBL_ADDRESS_WRITE);
+      transfer(_regOsdbl.byte);
+      deselect();
     }
     _isActivatedOsd = act;
   }
@@ -447,10 +612,22 @@ void Max7456::activateExternalVideo(bool activExtVid)
   else
     _regVm0.bits.synchSelect = 0; //00
 
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(VM0_ADDRESS_WRITE);
-  SPI.transfer(_regVm0.byte);
-  digitalWrite(_pinCS, HIGH);
+  select();
+  transfer(VM0_ADDRESS_WRITE);
+  transfer(_regVm0.byte);
+  deselect();
+}
+
+/******************************************************************************
+   Function: Max7456::setGrayBackground
+ ******************************************************************************/
+void Max7456::setGrayBackground(bool gray)
+{
+  _regVm1.bits.backgroundMode = gray ? 1 : 0;
+  select();
+  transfer(VM1_ADDRESS_WRITE);
+  transfer(_regVm1.byte);
+  deselect();
 }
 
 /******************************************************************************
@@ -475,20 +652,37 @@ CARACT Max7456::byteArray2CARACT(const charact array)
 }
 
 /******************************************************************************
-   Function: Max7456::getCARACFromProgMem
+   Function: Max7456::decodeCharacter
  ******************************************************************************/
-void Max7456::getCARACFromProgMem(const char *table, byte i, charact car)
+const byte *Max7456::decodeCharacter(const byte *dictionary, const byte *data, charact car)
 {
-  unsigned long index;
-  byte read;
-  index = i * 54;
-  for (unsigned long j = 0 ; j < 54 ; j++)
+  const byte *row = dictionary;       // Source of the previous row
+  byte code;
+  byte count;
+  byte i = 0;
+
+  while (i < 54)
   {
-    read = pgm_read_byte_near(table + index + j );
-    car[j] = read;
-    if (car[j] == 0x55)
-      car[j] = 0xff;
+    code = pgm_read_byte_near(data++);
+    count = 1;
+    if (code == FONT_CODE_LITERAL)
+    {
+      row = data;
+      data += 3;
+    }
+    else if (code >= FONT_CODE_REPEAT)
+      count = code - FONT_CODE_REPEAT + 1;
+    else
+      row = dictionary + 3 * code;
+
+    for ( ; count && (i < 54); count--, i += 3)
+    {
+      car[i] = pgm_read_byte_near(row);
+      car[i + 1] = pgm_read_byte_near(row + 1);
+      car[i + 2] = pgm_read_byte_near(row + 2);
+    }
   }
+  return data;
 }
 
 /******************************************************************************
@@ -496,34 +690,107 @@ void Max7456::getCARACFromProgMem(const char *table, byte i, charact car)
  ******************************************************************************/
 byte Max7456::getInVideoFormat( void )
 {
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(STAT_ADDRESS_READ);
-  _regStat.byte = SPI.transfer(0x00);
-  digitalWrite(_pinCS, HIGH);
+  select();
+  transfer(STAT_ADDRESS_READ);
+  _regStat.byte = transfer(0x00);
+  deselect();
 
   if (_regStat.bits.NTSCDetected ) return 0;
   if (_regStat.bits.PALDetected ) return 1;
   return 2;
 }
 
+/******************************************************************************
+   Function: Max7456::lossOfSync
+ ******************************************************************************/
+bool Max7456::lossOfSync( void )
+{
+  _regStat.byte = readRegister(STAT_ADDRESS_READ);
+  return _regStat.bits.LOS;
+}
+
 /******************************************************************************
    Function: Max7456::setOutVideoFormat
  ******************************************************************************/
 void Max7456::setOutVideoFormat( byte newVideoFormat )
 {
   // Read VM0 register
-  digitalWrite(_pinCS, LOW);
-  SPI.transfer(VM0_ADDRESS_READ);
-  _regVm0.byte = SPI.transfer(0x00);
-  digitalWrite(_pinCS, HIGH);
+  select();
+  transfer(VM0_ADDRESS_READ);
+  _regVm0.byte = transfer(0x00);
+  deselect();
 
   // Switch OSD video format
   if (_regVm0.bits.videoSelect != newVideoFormat )
   {
-    digitalWrite(_pinCS, LOW);
+    select();
     _regVm0.bits.videoSelect = newVideoFormat;
-    SPI.transfer(VM0_ADDRESS_WRITE);
-    SPI.transfer(_regVm0.byte);
-    digitalWrite(_pinCS, HIGH);
+    transfer(VM0_ADDRESS_WRITE);
+    transfer(_regVm0.byte);
+    deselect();
   }
 }
+
+/******************************************************************************
+   Function: Max7456::getSpiTransactions
+ ******************************************************************************/
+unsigned long Max7456::getSpiTransactions( void )
+{
+  return _spiTransactions;
+}
+
+/******************************************************************************
+   Function: Max7456::getBusyWaitTime
+ ******************************************************************************/
+unsigned long Max7456::getBusyWaitTime( void )
+{
+  return _busyWaitTime;
+}
+
+/******************************************************************************
+   Function: Max7456::getSpiBytes
+ ******************************************************************************/
+unsigned long Max7456::getSpiBytes( void )
+{
+  return _spiBytes;
+}
+
+/******************************************************************************
+   Function: Max7456::getBusTime
+ ******************************************************************************/
+unsigned long Max7456::getBusTime( void )
+{
+  return _busTime;
+}
+
+/******************************************************************************
+   Function: Max7456::select
+             Starts an SPI transaction by pulling ~CS low
+ ******************************************************************************/
+void Max7456::select( void )
+{
+  SPI.beginTransaction(SPISettings(MAX7456_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  *_csPort &= ~_csMask;
+  _spiTransactions++;
+  _selectTime = micros();
+}
+
+/******************************************************************************
+   Function: Max7456::deselect
+             Ends an SPI transaction
+ ******************************************************************************/
+void Max7456::deselect( void )
+{
+  *_csPort |= _csMask;
+  SPI.endTransaction();
+  _busTime += micros() - _selectTime;
+}
+
+/******************************************************************************
+   Function: Max7456::transfer
+ ******************************************************************************/
+byte Max7456::transfer( byte data )
+{
+  _spiBytes++;
+  return SPI.transfer(data);
+}
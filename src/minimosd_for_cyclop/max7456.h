@@ -29,6 +29,22 @@
 
 #include "max7456registers.h"
 
+/* Longest number printFixed can print: 10 digits, point and 9 decimals */
+#define MAX7456_MAX_DECIMALS  9
+#define MAX7456_NUMBER_DIGITS 20
+
+/* SPI clock. The max7456 accepts up to 10 MHz, the Atmega 328 gives at most
+   half its clock frequency */
+#define MAX7456_SPI_CLOCK     8000000
+
+/* Longest time to wait for the device to come out of reset. The old fixed
+   delays added up to 200 ms */
+#define MAX7456_RESET_TIMEOUT_MS  200
+
+/* Row codes of compressed fonts, see decodeCharacter */
+#define FONT_CODE_REPEAT      0xE0
+#define FONT_CODE_LITERAL     0xFF
+
 /*  class Max7456 - Represents a max7456 device communicating through SPI port */
 
 class Max7456
@@ -44,8 +60,14 @@ class Max7456
 
     /* Initialize communications and device
        pinCS : pin ~CS of the arduino where max7456 is plugged.
-       The same function as using constructor Max7456(byte pinCS) */
-    void init(byte pinCS);
+       The same function as using constructor Max7456(byte pinCS)
+       return : false if the device did not come out of reset in time */
+    bool init(byte pinCS);
+
+    /* Reset the device and set all registers to the values set by init.
+       Settings made after init, e.g. display offsets, are lost.
+       return : false if the device did not come out of reset in time */
+    bool reinit();
 
     /* Set the base time for blink.
        blinkBase : the base time (see datasheet)
@@ -57,9 +79,19 @@ class Max7456
        vertical : the vertical offset in pixels (between 0 and 31). */
     void setDisplayOffsets(byte horizontal, byte vertical);
 
-    /* Erase Display Memory */
+    /* Erase Display Memory. Waits until the memory is cleared */
     void clearScreen();
 
+    /* Start erasing Display Memory and return at once.
+       Use poll() to find out when the memory is cleared */
+    void startClearScreen();
+
+    /* Complete started operations
+       return : true if the device is ready, false if an operation started by
+                startClearScreen or startSendCharacter is still running.
+       All other functions wait for started operations to complete. */
+    bool poll();
+
     /* Activate osd on screen
        act :
         if true OSD is activated
@@ -72,11 +104,23 @@ class Max7456
          if false external video is not displayed (bakground = grey) */
     void activateExternalVideo(bool activExtVid = true);
 
+    /* Set all background pixels of the display to gray
+       gray :
+         if true the background is gray
+         if false each character sets its own background */
+    void setGrayBackground(bool gray = true);
+
     /* Put a character in the memory character of max7456
        array : the byte array representing the character (54 bytes long)
        pos : the ascii table char position. */
     void sendCharacter(const charact array, byte pos);
 
+    /* Start writing a character to the character memory of max7456 and
+       return at once. Use poll() to find out when the write is done.
+       array : the byte array representing the character (54 bytes long)
+       pos : the ascii table char position. */
+    void startSendCharacter(const charact array, byte pos);
+
     /* Get a character from the character memory of max7456
        array : the byte array representing the character (54 bytes long)
        x : the horizontal position of character in character memory
@@ -91,6 +135,28 @@ class Max7456
        inv : if 1 then color character will be inverted */
     void print(const char string[], byte x, byte y, byte blink = 0, byte inv = 0);
 
+    /* Put a string from program memory in the display memory of max7456
+       string : The string to be displayed, e.g. F("text")
+       x : the horizontal position of the string on screen
+       y : the vertical position of the string on screen
+       blink : if 1 then character will blink
+       inv : if 1 then color character will be inverted */
+    void print(const __FlashStringHelper *string, byte x, byte y, byte blink = 0, byte inv = 0);
+
+    /* Put a fixed point number in the display memory of max7456
+       value : The value to be displayed, in units of 10^-decimals
+       x : the horizontal position of the value on screen
+       y : the vertical position of the value on screen
+       width : minimum number of printed characters, padded on the left
+       decimals : number of digits after the point (0-9)
+       pad : the padding character, e.g. ' ' or '0'
+       blink : if 1 then character will blink
+       inv : if 1 then color character will be inverted
+       Example:
+         max.printFixed(-314, x, y, 6, 2, '0');
+         Will print "-03.14" on screen */
+    void printFixed(long value, byte x, byte y, byte width, byte decimals = 0, char pad = ' ', byte blink = 0, byte inv = 0);
+
     /* Put a float in the display memory of max7456
        value : The value to be displayed
        x : the horizontal position of the value on screen
@@ -100,9 +166,7 @@ class Max7456
        blink : if 1 then character will blink
        inv : if 1 then color character will be inverted
        The number of printed characters will be : before + after + 1.
-       Be aware of having a coherence between the number of digits you enter
-       in the function and the max. value of your double. If not may result
-       in unpredictable printed string.
+       Values that do not fit are printed with more characters.
        Example:
          max.print(3.14,x,y,3,4);
          Will print "003.1400" on screen */
@@ -127,12 +191,13 @@ class Max7456
        inv : if 1 then color character will be inverted */
     void printMax7456Char(const byte address, byte x, byte y, byte blink = 0, byte inv = 0);
 
-    /* Print a character to Serial port
+    /* Print a character to a serial port
        array : the byte array representing the character (54 bytes long)
+       serial : the port to print to, e.g. Serial
        img :
          true : the character will be displayed as a picture
          false : the character will be displayed as a byte array */
-    static void printCharacterToSerial(const charact array, bool img = true);
+    static void printCharacterToSerial(const charact array, Print &serial, bool img = true);
 
     /* Converts a CARACT character to a byte array representation.
        car : the CARACT character
@@ -144,29 +209,66 @@ class Max7456
        return :  the CARACT character */
     static CARACT byteArray2CARACT(const charact array);
 
-    /* Get the ith character from program memory
-       table the address of the array in prog memory
-       i the index of character.
-       c the returned character.
-       The table must be in program memory as an array of bytes (a multiple of 54).
-       When accessing this array, 0x55 are interpreted as 0xFF (you can't have 0xFF in program memory.
-       See file example for more informations. */
-    static void getCARACFromProgMem(const char *table, byte i, charact c);
+    /* Decode a character from a compressed font in program memory.
+       dictionary : the row dictionary of the font
+       data : the coded rows of the character
+       c : the returned character
+       return : the coded rows of the next character
+       A character is coded as 18 rows of 3 bytes, each row being
+         0x00-0xDF : an index of a row in the dictionary
+         0xE0-0xFE : the previous row repeated 1-31 more times
+         0xFF      : a literal row, the 3 row bytes follow
+       Fonts are made with "character generation/mcm2font.py". */
+    static const byte *decodeCharacter(const byte *dictionary, const byte *data, charact c);
 
     /* Retrieve current invideo format
-       return: 0=NTSC, 1=PAL, 3= No format detected */
+       return: 0=NTSC, 1=PAL, 2= No format detected */
     byte getInVideoFormat( void );
 
+    /* Check the input video sync
+       return: true if the sync of the input video is lost */
+    bool lossOfSync( void );
+
     /* Sets video format
        Operation is only done if the video format differs from the one in use
        newVideoFormat: 0=NTSC, 1=PAL */
     void setOutVideoFormat( byte newVideoFormat );
 
+    /* Number of SPI transactions (~CS low cycles) since init */
+    unsigned long getSpiTransactions( void );
+
+    /* Time in microseconds spent busy-waiting for the device since init */
+    unsigned long getBusyWaitTime( void );
+
+    /* Number of bytes transferred on the SPI bus since init */
+    unsigned long getSpiBytes( void );
+
+    /* Time in microseconds ~CS has been held low since init */
+    unsigned long getBusTime( void );
+
   private:
-    static void printPixel(byte value);
+    static void printPixel(Print &serial, byte value);
+    void select( void );
+    void deselect( void );
+    void waitReady( void );
+    byte transfer( byte data );
+    byte readRegister(byte address);
+    bool reset();
+    void beginDisplayWrite(byte x, byte y, byte blink, byte inv);
+    void writeDisplayByte(byte c);
+    void endDisplayWrite(void);
 
     byte _pinCS;
+    volatile uint8_t *_csPort;  // Output register and bit of the ~CS pin
+    uint8_t _csMask;
     bool _isActivatedOsd;
+    bool _clearBusy;          // Display memory clear in progress
+    bool _nvmBusy;            // Character memory write in progress
+    unsigned long _spiTransactions;
+    unsigned long _spiBytes;
+    unsigned long _busTime;
+    unsigned long _selectTime;
+    unsigned long _busyWaitTime;
     
     // Shadow Registers
     // Keep in synch with internal registers at all times to avoid unnecessary reads
@@ -31,1759 +31,29 @@
   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
   SOFTWARE.
- *******************************************************************************
-   Character bitmaps stored in program memory. Needs more memory than in RAM
-   0xFF is stored as 0x55 since program memory canmot hold series of 0xFF
- *******************************************************************************/
-const char tableOfAllCharacters[13824] PROGMEM = {
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x00, 0x55, 0x50, 0xaa, 0x05, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x50, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x00, 0x55, 0x50, 0xaa, 0x05, 0x4a, 0xaa, 0xa1,
-  0x48, 0x00, 0x21, 0x48, 0x55, 0x21, 0x48, 0x00,
-  0x21, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55,
-  0x50, 0xaa, 0x05, 0x4a, 0xaa, 0xa1, 0x48, 0x00,
-  0x21, 0x48, 0x55, 0x21, 0x48, 0x55, 0x21, 0x48,
-  0x55, 0x21, 0x48, 0x55, 0x21, 0x48, 0x00, 0x21,
-  0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50, 0x00, 0x05,
-  0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x50, 0xaa,
-  0x05, 0x4a, 0xaa, 0xa1, 0x48, 0x00, 0x21, 0x48,
-  0x55, 0x21, 0x48, 0x55, 0x21, 0x48, 0x55, 0x21,
-  0x48, 0x55, 0x21, 0x48, 0x55, 0x21, 0x48, 0x55,
-  0x21, 0x48, 0x55, 0x21, 0x48, 0x00, 0x21, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x50, 0x00, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x00, 0x55, 0x50, 0xaa, 0x05, 0x4a,
-  0xaa, 0xa1, 0x48, 0x00, 0x21, 0x48, 0x55, 0x21,
-  0x48, 0x55, 0x21, 0x48, 0x55, 0x21, 0x48, 0x55,
-  0x21, 0x48, 0x55, 0x21, 0x48, 0x55, 0x21, 0x48,
-  0x55, 0x21, 0x48, 0x55, 0x21, 0x48, 0x55, 0x21,
-  0x48, 0x55, 0x21, 0x48, 0x00, 0x21, 0x4a, 0xaa,
-  0xa1, 0x50, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x50, 0x55, 0x55, 0x4a, 0x55, 0x55, 0x48,
-  0x55, 0x55, 0x48, 0x55, 0x55, 0x48, 0x55, 0x55,
-  0x48, 0x55, 0x55, 0x48, 0x55, 0x55, 0x48, 0x55,
-  0x55, 0x48, 0x55, 0x55, 0x48, 0x55, 0x55, 0x48,
-  0x55, 0x55, 0x48, 0x55, 0x55, 0x48, 0x55, 0x55,
-  0x48, 0x55, 0x55, 0x4a, 0x55, 0x55, 0x50, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
-  0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa,
-  0xaa, 0xaa, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xaa, 0xaa,
-  0xaa, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x15, 0xaa,
-  0xaa, 0x15, 0xaa, 0xaa, 0x15, 0xaa, 0xaa, 0x15,
-  0xaa, 0xaa, 0x15, 0xaa, 0xaa, 0x15, 0xaa, 0xaa,
-  0x15, 0xaa, 0xaa, 0x15, 0xaa, 0xaa, 0x15, 0xaa,
-  0xaa, 0x15, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa,
-  0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00,
-  0x00, 0x00, 0xaa, 0x15, 0x55, 0xaa, 0x15, 0x55,
-  0xaa, 0x15, 0x55, 0xaa, 0x15, 0x55, 0xaa, 0x15,
-  0x55, 0xaa, 0x15, 0x55, 0xaa, 0x15, 0x55, 0xaa,
-  0x15, 0x55, 0xaa, 0x15, 0x55, 0xaa, 0x15, 0x55,
-  0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00,
-  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00,
-  0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
-  0x00, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55,
-  0xa1, 0x55, 0x55, 0x21, 0x55, 0x55, 0x21, 0x55,
-  0x55, 0x21, 0x55, 0x55, 0x21, 0x55, 0x55, 0x21,
-  0x55, 0x55, 0x21, 0x55, 0x55, 0x21, 0x55, 0x55,
-  0x21, 0x55, 0x55, 0x21, 0x55, 0x55, 0x21, 0x55,
-  0x55, 0x21, 0x55, 0x55, 0x21, 0x55, 0x55, 0xa1,
-  0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x2a, 0x05, 0x41, 0x80, 0xa1, 0x28, 0x80, 0x08,
-  0x28, 0x80, 0x02, 0x81, 0xa0, 0x02, 0x85, 0xa0,
-  0x08, 0x21, 0x28, 0x20, 0x08, 0x4a, 0x80, 0x08,
-  0x4a, 0x80, 0x02, 0x4a, 0xa0, 0x02, 0x50, 0xaa,
-  0x02, 0x54, 0x8a, 0xa8, 0x54, 0x80, 0x01, 0x54,
-  0x85, 0x55, 0x52, 0xa1, 0x55, 0x4a, 0xa8, 0x55,
-  0x2a, 0xaa, 0x15, 0x00, 0x00, 0x05, 0x45, 0x45,
-  0x55, 0x21, 0x21, 0x55, 0x28, 0xa1, 0x55, 0x22,
-  0x21, 0x55, 0x20, 0x21, 0x55, 0x21, 0x21, 0x55,
-  0x45, 0x04, 0x55, 0x54, 0x82, 0x15, 0x54, 0x82,
-  0x15, 0x54, 0xaa, 0x15, 0x54, 0x82, 0x15, 0x54,
-  0x82, 0x15, 0x55, 0x14, 0x01, 0x55, 0x52, 0xa8,
-  0x55, 0x54, 0x21, 0x55, 0x54, 0x81, 0x55, 0x52,
-  0xa8, 0x55, 0x54, 0x01, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x00, 0x55, 0x54, 0xaa, 0x15,
-  0x52, 0x96, 0x85, 0x52, 0x96, 0x85, 0x52, 0x96,
-  0x85, 0x54, 0xaa, 0x15, 0x55, 0x00, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x11, 0x15, 0x55, 0x66, 0x45,
-  0x55, 0x19, 0x95, 0x55, 0x66, 0x45, 0x55, 0x19,
-  0x95, 0x55, 0x66, 0x45, 0x55, 0x19, 0x95, 0x55,
-  0x66, 0x45, 0x55, 0x11, 0x15, 0x55, 0x44, 0x45,
-  0x55, 0x19, 0x95, 0x55, 0x66, 0x45, 0x55, 0x19,
-  0x95, 0x55, 0x66, 0x45, 0x55, 0x19, 0x95, 0x55,
-  0x66, 0x45, 0x55, 0x19, 0x95, 0x55, 0x44, 0x45,
-  0x55, 0x11, 0x15, 0x55, 0x66, 0x45, 0x55, 0x19,
-  0x95, 0x55, 0x66, 0x45, 0x55, 0x19, 0x95, 0x55,
-  0x66, 0x45, 0x55, 0x19, 0x95, 0x55, 0x66, 0x45,
-  0x55, 0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x51, 0x11, 0x55, 0x56, 0x64, 0x55, 0x51, 0x99,
-  0x55, 0x56, 0x64, 0x55, 0x51, 0x99, 0x55, 0x56,
-  0x64, 0x55, 0x51, 0x99, 0x55, 0x56, 0x64, 0x55,
-  0x51, 0x11, 0x55, 0x54, 0x44, 0x55, 0x51, 0x99,
-  0x55, 0x56, 0x64, 0x55, 0x51, 0x99, 0x55, 0x56,
-  0x64, 0x55, 0x51, 0x99, 0x55, 0x56, 0x64, 0x55,
-  0x51, 0x99, 0x55, 0x54, 0x44, 0x55, 0x51, 0x11,
-  0x55, 0x56, 0x64, 0x55, 0x51, 0x99, 0x55, 0x56,
-  0x64, 0x55, 0x51, 0x99, 0x55, 0x56, 0x64, 0x55,
-  0x51, 0x99, 0x55, 0x56, 0x64, 0x55, 0x51, 0x11,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x11, 0x11, 0x11, 0x66, 0x46,
-  0x64, 0x19, 0x91, 0x99, 0x66, 0x46, 0x64, 0x19,
-  0x91, 0x99, 0x66, 0x46, 0x64, 0x19, 0x91, 0x99,
-  0x66, 0x46, 0x64, 0x11, 0x11, 0x11, 0x44, 0x45,
-  0x55, 0x19, 0x95, 0x55, 0x66, 0x45, 0x55, 0x19,
-  0x95, 0x55, 0x66, 0x45, 0x55, 0x19, 0x95, 0x55,
-  0x66, 0x45, 0x55, 0x19, 0x95, 0x55, 0x44, 0x45,
-  0x55, 0x11, 0x11, 0x11, 0x66, 0x46, 0x64, 0x19,
-  0x91, 0x99, 0x66, 0x46, 0x64, 0x19, 0x91, 0x99,
-  0x66, 0x46, 0x64, 0x19, 0x91, 0x99, 0x66, 0x46,
-  0x64, 0x11, 0x11, 0x11, 0x55, 0x54, 0x44, 0x55,
-  0x51, 0x99, 0x55, 0x56, 0x64, 0x55, 0x51, 0x99,
-  0x55, 0x56, 0x64, 0x55, 0x51, 0x99, 0x55, 0x56,
-  0x64, 0x55, 0x51, 0x99, 0x55, 0x54, 0x44, 0x11,
-  0x11, 0x11, 0x66, 0x46, 0x64, 0x19, 0x91, 0x99,
-  0x66, 0x46, 0x64, 0x19, 0x91, 0x99, 0x66, 0x46,
-  0x64, 0x19, 0x91, 0x99, 0x66, 0x46, 0x64, 0x11,
-  0x11, 0x11, 0x44, 0x44, 0x44, 0x19, 0x91, 0x99,
-  0x66, 0x46, 0x64, 0x19, 0x91, 0x99, 0x66, 0x46,
-  0x64, 0x19, 0x91, 0x99, 0x66, 0x46, 0x64, 0x19,
-  0x91, 0x99, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11,
-  0x66, 0x46, 0x64, 0x19, 0x91, 0x99, 0x66, 0x46,
-  0x64, 0x19, 0x91, 0x99, 0x66, 0x46, 0x64, 0x19,
-  0x91, 0x99, 0x66, 0x46, 0x64, 0x11, 0x11, 0x11,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x19, 0x91, 0x99,
-  0x66, 0x46, 0x64, 0x11, 0x11, 0x11, 0x66, 0x66,
-  0x66, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x11,
-  0x11, 0x11, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11,
-  0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x66, 0x66,
-  0x66, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x11,
-  0x11, 0x11, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11,
-  0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x66, 0x66,
-  0x66, 0x11, 0x11, 0x11, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x41, 0x55,
-  0x55, 0x41, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x54, 0x55, 0x15, 0x52, 0x14, 0x85,
-  0x4a, 0x82, 0xa1, 0x52, 0x84, 0xa1, 0x54, 0x85,
-  0x21, 0x54, 0x85, 0x21, 0x52, 0x14, 0x85, 0x54,
-  0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x54, 0x14, 0x15, 0x52, 0x82, 0x85, 0x52,
-  0x82, 0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x52, 0x82, 0x85, 0x52, 0x82, 0x85, 0x4a, 0xaa,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x52, 0x82, 0x85, 0x52,
-  0x82, 0x85, 0x54, 0x14, 0x15, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x00, 0x55, 0x55, 0x28, 0x55, 0x50,
-  0x28, 0x05, 0x42, 0xaa, 0x81, 0x4a, 0xaa, 0xa1,
-  0x4a, 0x28, 0xa1, 0x4a, 0x28, 0x01, 0x42, 0xaa,
-  0x81, 0x40, 0x28, 0xa1, 0x4a, 0x28, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x42, 0xaa, 0x81, 0x50, 0x28, 0x05,
-  0x55, 0x28, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
-  0x55, 0x55, 0x48, 0x54, 0x15, 0x22, 0x12, 0x85,
-  0x48, 0x4a, 0x85, 0x51, 0x4a, 0x15, 0x55, 0x2a,
-  0x15, 0x55, 0x28, 0x55, 0x54, 0xa8, 0x55, 0x54,
-  0xa1, 0x55, 0x52, 0xa1, 0x55, 0x52, 0x85, 0x15,
-  0x4a, 0x84, 0x85, 0x4a, 0x12, 0x21, 0x4a, 0x14,
-  0x85, 0x50, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
-  0x54, 0xa8, 0x55, 0x52, 0xaa, 0x15, 0x52, 0x8a,
-  0x15, 0x52, 0x82, 0x15, 0x52, 0x82, 0x15, 0x52,
-  0xaa, 0x15, 0x54, 0xa8, 0x45, 0x52, 0xaa, 0x21,
-  0x4a, 0x8a, 0xa1, 0x4a, 0x0a, 0x85, 0x4a, 0x02,
-  0x85, 0x4a, 0x8a, 0xa1, 0x52, 0xa8, 0xa1, 0x54,
-  0x01, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x51, 0x55, 0x55, 0x48, 0x55, 0x55, 0x2a,
-  0x15, 0x55, 0x4a, 0x15, 0x55, 0x52, 0x15, 0x55,
-  0x52, 0x15, 0x55, 0x48, 0x55, 0x55, 0x51, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x05, 0x55, 0x54, 0xa1, 0x55,
-  0x52, 0x85, 0x55, 0x4a, 0x15, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x4a, 0x15, 0x55, 0x52, 0x85,
-  0x55, 0x54, 0xa1, 0x55, 0x55, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-  0x15, 0x55, 0x52, 0x85, 0x55, 0x54, 0xa1, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x4a, 0x15, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x55, 0x28, 0x55, 0x54, 0xa1, 0x55, 0x52, 0x85,
-  0x55, 0x54, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x14, 0x55, 0x54, 0x82, 0x15,
-  0x54, 0x28, 0x15, 0x52, 0xaa, 0x85, 0x54, 0x28,
-  0x15, 0x54, 0x82, 0x15, 0x55, 0x14, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x28, 0x55,
-  0x54, 0x28, 0x15, 0x52, 0xaa, 0x85, 0x52, 0xaa,
-  0x85, 0x54, 0x28, 0x15, 0x55, 0x28, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x54, 0xa1, 0x55,
-  0x52, 0x85, 0x55, 0x54, 0x15, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x52, 0xaa, 0x85, 0x54, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50,
-  0x05, 0x55, 0x42, 0x85, 0x55, 0x4a, 0x85, 0x55,
-  0x0a, 0x05, 0x55, 0x2a, 0x15, 0x54, 0x28, 0x15,
-  0x54, 0xa8, 0x55, 0x50, 0xa0, 0x55, 0x52, 0xa1,
-  0x55, 0x42, 0x81, 0x55, 0x4a, 0x85, 0x55, 0x4a,
-  0x05, 0x55, 0x4a, 0x15, 0x55, 0x40, 0x15, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x54, 0x00, 0x15, 0x52, 0xaa, 0x85,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x52, 0xaa, 0x85, 0x54, 0x00, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x41, 0x55, 0x55, 0x28, 0x55, 0x54, 0xa8,
-  0x55, 0x52, 0xa8, 0x55, 0x54, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x54, 0x28, 0x15, 0x52, 0xaa, 0x85, 0x52, 0xaa,
-  0x85, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00,
-  0x15, 0x52, 0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x12, 0xa1, 0x50, 0x4a, 0x85,
-  0x55, 0x2a, 0x15, 0x54, 0xa8, 0x55, 0x52, 0xa0,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x15, 0x4a,
-  0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x50, 0x00, 0xa1,
-  0x55, 0x00, 0xa1, 0x54, 0xaa, 0x85, 0x54, 0xaa,
-  0x85, 0x55, 0x00, 0xa1, 0x50, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0x85, 0x50, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x50, 0x15, 0x55, 0x4a, 0x85,
-  0x55, 0x2a, 0x85, 0x54, 0xa2, 0x85, 0x52, 0x82,
-  0x85, 0x4a, 0x02, 0x85, 0x4a, 0xaa, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x50, 0x02, 0x85, 0x55, 0x52, 0x85,
-  0x55, 0x52, 0x85, 0x55, 0x54, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x00, 0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0x00, 0x05, 0x4a, 0xaa, 0x85, 0x4a,
-  0xaa, 0xa1, 0x50, 0x00, 0xa1, 0x50, 0x54, 0xa1,
-  0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0xa1, 0x52, 0xaa,
-  0x85, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00,
-  0x15, 0x52, 0xaa, 0x85, 0x4a, 0xaa, 0x85, 0x4a,
-  0x00, 0x15, 0x4a, 0x00, 0x15, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x00,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x52, 0xaa, 0x85, 0x54,
-  0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x05, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50, 0x00, 0xa1,
-  0x55, 0x52, 0xa1, 0x55, 0x4a, 0x85, 0x55, 0x2a,
-  0x15, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x41, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x54, 0x00, 0x15, 0x52, 0xaa, 0x85,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x00,
-  0xa1, 0x52, 0xaa, 0x85, 0x52, 0xaa, 0x85, 0x4a,
-  0x00, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x52, 0xaa, 0x85, 0x54, 0x00, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x54, 0x00, 0x15, 0x52, 0xaa, 0x85, 0x4a, 0xaa,
-  0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0xa1, 0x54, 0x00, 0xa1,
-  0x50, 0x00, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0x85, 0x50, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x41, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x54, 0xa1, 0x55, 0x55, 0x05, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x54, 0x15, 0x55, 0x52, 0x85,
-  0x55, 0x4a, 0x15, 0x55, 0x28, 0x55, 0x54, 0xa1,
-  0x55, 0x52, 0x85, 0x55, 0x52, 0x85, 0x55, 0x54,
-  0xa1, 0x55, 0x55, 0x28, 0x55, 0x55, 0x4a, 0x15,
-  0x55, 0x52, 0x85, 0x55, 0x54, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00,
-  0x15, 0x52, 0xaa, 0x85, 0x52, 0xaa, 0x85, 0x54,
-  0x00, 0x15, 0x54, 0x00, 0x15, 0x52, 0xaa, 0x85,
-  0x52, 0xaa, 0x85, 0x54, 0x00, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x55, 0x4a, 0x15, 0x55, 0x52, 0x85, 0x55, 0x54,
-  0xa1, 0x55, 0x55, 0x28, 0x55, 0x55, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x28, 0x55, 0x54, 0xa1,
-  0x55, 0x52, 0x85, 0x55, 0x4a, 0x15, 0x55, 0x50,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52, 0xaa,
-  0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0x14, 0xa1, 0x50, 0x54, 0xa1, 0x55, 0x52, 0xa1,
-  0x55, 0x4a, 0x85, 0x55, 0x2a, 0x15, 0x55, 0x28,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x41, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x41, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x54, 0x00, 0x15, 0x52, 0xaa, 0x85, 0x4a,
-  0x00, 0xa1, 0x28, 0x55, 0x28, 0x21, 0x00, 0x48,
-  0x20, 0xaa, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
-  0x08, 0x20, 0x8a, 0xa8, 0x20, 0xa8, 0xa1, 0x20,
-  0x01, 0x05, 0x28, 0x55, 0x05, 0x4a, 0x00, 0xa1,
-  0x52, 0xaa, 0x85, 0x54, 0x00, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x54,
-  0xaa, 0x15, 0x52, 0xaa, 0x85, 0x4a, 0x82, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x50, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x55, 0x4a, 0xaa, 0x15,
-  0x4a, 0xaa, 0x85, 0x4a, 0x02, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x02, 0xa1, 0x4a,
-  0xaa, 0x85, 0x4a, 0xaa, 0x85, 0x4a, 0x02, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x02,
-  0xa1, 0x4a, 0xaa, 0x85, 0x4a, 0xaa, 0x15, 0x50,
-  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x55, 0x54, 0xaa, 0x15, 0x52, 0xaa,
-  0x85, 0x4a, 0x82, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x15, 0x05, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x52,
-  0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55, 0x00, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x55, 0x4a, 0xaa, 0x15, 0x4a, 0xaa, 0x85, 0x4a,
-  0x02, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x02, 0xa1, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0x15, 0x50, 0x00, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x05, 0x4a,
-  0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0x05,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x00,
-  0x55, 0x4a, 0xaa, 0x15, 0x4a, 0xaa, 0x15, 0x4a,
-  0x00, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x00, 0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x50, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x05, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0x05, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x00, 0x55, 0x4a,
-  0xaa, 0x15, 0x4a, 0xaa, 0x15, 0x4a, 0x00, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x50,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x54, 0x00, 0x55, 0x52, 0xaa, 0x15, 0x4a, 0xaa,
-  0x85, 0x4a, 0x82, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x15, 0x05, 0x4a, 0x00, 0x05,
-  0x4a, 0x0a, 0xa1, 0x4a, 0x0a, 0xa1, 0x4a, 0x10,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0xa1, 0x54, 0x00, 0x05,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x52, 0xaa, 0x85, 0x54, 0x28, 0x15,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x54, 0x28, 0x15, 0x52, 0xaa, 0x85, 0x52, 0xaa,
-  0x85, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x40, 0x05, 0x55, 0x2a, 0xa1,
-  0x55, 0x2a, 0xa1, 0x55, 0x42, 0x85, 0x55, 0x52,
-  0x85, 0x55, 0x52, 0x85, 0x55, 0x52, 0x85, 0x55,
-  0x52, 0x85, 0x55, 0x52, 0x85, 0x55, 0x52, 0x85,
-  0x50, 0x52, 0x85, 0x4a, 0x12, 0x85, 0x4a, 0x02,
-  0x85, 0x4a, 0xaa, 0x85, 0x52, 0xaa, 0x15, 0x54,
-  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x12, 0x85, 0x4a, 0x12, 0x85, 0x4a,
-  0x0a, 0x15, 0x4a, 0x0a, 0x15, 0x4a, 0xa8, 0x55,
-  0x4a, 0x28, 0x55, 0x4a, 0x0a, 0x15, 0x4a, 0x0a,
-  0x15, 0x4a, 0x12, 0x85, 0x4a, 0x12, 0x85, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x00, 0x05, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x50, 0x00, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x4a,
-  0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0x28,
-  0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x50, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x84,
-  0xa1, 0x4a, 0x84, 0xa1, 0x4a, 0xa0, 0xa1, 0x4a,
-  0xa8, 0xa1, 0x4a, 0x2a, 0xa1, 0x4a, 0x0a, 0xa1,
-  0x4a, 0x12, 0xa1, 0x4a, 0x12, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x50,
-  0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x55, 0x54, 0xaa, 0x15, 0x52, 0xaa,
-  0x85, 0x4a, 0x82, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x52,
-  0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55, 0x00, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x55, 0x4a, 0xaa, 0x15, 0x4a, 0xaa, 0x85, 0x4a,
-  0x02, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x02, 0xa1, 0x4a, 0xaa, 0x85, 0x4a, 0xaa,
-  0x15, 0x4a, 0x00, 0x55, 0x4a, 0x15, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x54,
-  0xaa, 0x15, 0x52, 0xaa, 0x85, 0x4a, 0x82, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0x2a, 0xa1,
-  0x4a, 0x8a, 0x85, 0x52, 0xaa, 0xa1, 0x54, 0xa8,
-  0xa1, 0x55, 0x01, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x55, 0x4a, 0xaa, 0x15,
-  0x4a, 0xaa, 0x85, 0x4a, 0x02, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x02, 0xa1, 0x4a,
-  0xaa, 0x85, 0x4a, 0xa8, 0x15, 0x4a, 0xa8, 0x55,
-  0x4a, 0x2a, 0x15, 0x4a, 0x0a, 0x85, 0x4a, 0x12,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x50,
-  0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x55, 0x54, 0xaa, 0x15, 0x52, 0xaa,
-  0x85, 0x4a, 0x82, 0xa1, 0x4a, 0x14, 0x05, 0x4a,
-  0x15, 0x55, 0x4a, 0x81, 0x55, 0x52, 0xa8, 0x15,
-  0x54, 0x2a, 0x85, 0x55, 0x42, 0xa1, 0x55, 0x54,
-  0xa1, 0x50, 0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x52,
-  0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55, 0x00, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x28, 0x05, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x82, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0xaa,
-  0x15, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x82, 0xa1, 0x52, 0x82, 0x85, 0x52, 0xaa,
-  0x85, 0x54, 0xaa, 0x15, 0x55, 0x28, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0x28, 0xa1,
-  0x4a, 0x28, 0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0x28,
-  0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0xaa, 0xa1, 0x52,
-  0xaa, 0x85, 0x52, 0x82, 0x85, 0x54, 0x14, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x52, 0x82, 0x85,
-  0x54, 0xaa, 0x15, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x54, 0xaa, 0x15, 0x52, 0x82, 0x85, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x82,
-  0xa1, 0x52, 0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x05, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x50, 0x00, 0xa1, 0x55, 0x54,
-  0xa1, 0x55, 0x52, 0xa1, 0x55, 0x4a, 0x85, 0x55,
-  0x2a, 0x15, 0x54, 0xa8, 0x55, 0x52, 0xa1, 0x55,
-  0x4a, 0x85, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x00,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x55, 0x2a,
-  0x85, 0x55, 0x2a, 0x85, 0x55, 0x28, 0x15, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x15, 0x55,
-  0x2a, 0x85, 0x55, 0x2a, 0x85, 0x55, 0x40, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x85, 0x55, 0x52, 0x85, 0x55,
-  0x52, 0xa1, 0x55, 0x54, 0xa1, 0x55, 0x54, 0xa8,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x2a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x85, 0x55, 0x52, 0x85,
-  0x55, 0x52, 0x85, 0x55, 0x54, 0x15, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-  0x01, 0x55, 0x52, 0xa8, 0x55, 0x52, 0xa8, 0x55,
-  0x54, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x54, 0x28, 0x55, 0x52, 0xa8, 0x55, 0x52, 0xa8,
-  0x55, 0x54, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55,
-  0x55, 0x28, 0x55, 0x54, 0xaa, 0x15, 0x52, 0x82,
-  0x85, 0x52, 0x14, 0x85, 0x54, 0x55, 0x15, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x40, 0x00, 0x01, 0x2a, 0xaa, 0xa8, 0x2a,
-  0xaa, 0xa8, 0x40, 0x00, 0x01, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x4a, 0x15,
-  0x55, 0x52, 0x85, 0x55, 0x54, 0xa1, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x55, 0x54, 0xaa, 0x15, 0x52, 0xaa,
-  0x85, 0x4a, 0x82, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1,
-  0x4a, 0x00, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x50, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x15, 0x4a, 0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0x85, 0x4a, 0x00, 0xa1, 0x4a, 0x00,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0x85, 0x50,
-  0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1,
-  0x4a, 0x15, 0x05, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x05, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x55, 0x4a, 0xaa, 0x15,
-  0x4a, 0xaa, 0x85, 0x4a, 0x02, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x02, 0xa1, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0x15, 0x50, 0x00, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x00, 0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x4a, 0x00, 0x05, 0x4a, 0x00, 0x55, 0x4a,
-  0xaa, 0x15, 0x4a, 0xaa, 0x15, 0x4a, 0x00, 0x55,
-  0x4a, 0x00, 0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa,
-  0xa1, 0x50, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a,
-  0x00, 0x05, 0x4a, 0x00, 0x15, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0x85, 0x4a, 0x00, 0x15, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x50,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0x80, 0xa1,
-  0x4a, 0x10, 0x05, 0x4a, 0x0a, 0xa1, 0x4a, 0x0a,
-  0xa1, 0x4a, 0x10, 0xa1, 0x4a, 0x80, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x00,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x55, 0x54, 0xaa, 0x15, 0x54, 0xaa,
-  0x15, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x54, 0xaa, 0x15, 0x54, 0xaa,
-  0x15, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40,
-  0x05, 0x55, 0x2a, 0xa1, 0x55, 0x2a, 0xa1, 0x55,
-  0x42, 0x85, 0x55, 0x52, 0x85, 0x55, 0x52, 0x85,
-  0x55, 0x52, 0x85, 0x54, 0x12, 0x85, 0x52, 0x82,
-  0x85, 0x52, 0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55,
-  0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x4a,
-  0x14, 0xa1, 0x4a, 0x12, 0xa1, 0x4a, 0x0a, 0x85,
-  0x4a, 0x2a, 0x15, 0x4a, 0xa8, 0x55, 0x4a, 0xa8,
-  0x55, 0x4a, 0xaa, 0x15, 0x4a, 0x0a, 0x85, 0x4a,
-  0x12, 0xa1, 0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x55, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15,
-  0x55, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55, 0x4a,
-  0x15, 0x55, 0x4a, 0x00, 0x05, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x50, 0x00, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x82,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0x28, 0xa1, 0x4a,
-  0x28, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x50, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x84, 0xa1, 0x4a, 0xa0, 0xa1, 0x4a, 0xa8, 0xa1,
-  0x4a, 0x2a, 0xa1, 0x4a, 0x0a, 0xa1, 0x4a, 0x12,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x50,
-  0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x15, 0x4a, 0xaa, 0x85,
-  0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x00,
-  0xa1, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0x85, 0x4a,
-  0x00, 0x15, 0x4a, 0x15, 0x55, 0x4a, 0x15, 0x55,
-  0x4a, 0x15, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x54, 0x00, 0x15, 0x52, 0xaa, 0x85, 0x4a, 0xaa,
-  0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x10, 0xa1, 0x4a, 0x0a, 0xa1,
-  0x4a, 0x0a, 0x85, 0x4a, 0xaa, 0xa1, 0x52, 0xa8,
-  0xa1, 0x54, 0x01, 0x05, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x15, 0x4a, 0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a,
-  0x00, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0x85,
-  0x4a, 0xa8, 0x15, 0x4a, 0x2a, 0x15, 0x4a, 0x0a,
-  0x85, 0x4a, 0x12, 0xa1, 0x4a, 0x14, 0xa1, 0x50,
-  0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x54, 0x00, 0x15, 0x52,
-  0xaa, 0x85, 0x4a, 0xaa, 0xa1, 0x4a, 0x00, 0xa1,
-  0x4a, 0x00, 0x05, 0x4a, 0xaa, 0x85, 0x52, 0xaa,
-  0xa1, 0x50, 0x00, 0xa1, 0x4a, 0x00, 0xa1, 0x4a,
-  0xaa, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0x00, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x00, 0x05, 0x4a, 0xaa, 0xa1,
-  0x4a, 0xaa, 0xa1, 0x50, 0x28, 0x05, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x00, 0xa1, 0x4a, 0xaa, 0xa1, 0x52, 0xaa,
-  0x85, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
-  0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x52, 0xaa,
-  0x85, 0x54, 0xaa, 0x15, 0x55, 0x28, 0x55, 0x55,
-  0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x4a,
-  0x14, 0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x14, 0xa1,
-  0x4a, 0x14, 0xa1, 0x4a, 0x00, 0xa1, 0x4a, 0x28,
-  0xa1, 0x4a, 0x28, 0xa1, 0x4a, 0xaa, 0xa1, 0x52,
-  0xaa, 0x85, 0x52, 0x82, 0x85, 0x54, 0x14, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1,
-  0x4a, 0x82, 0xa1, 0x52, 0xaa, 0x85, 0x54, 0xaa,
-  0x15, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x54,
-  0xaa, 0x15, 0x52, 0xaa, 0x85, 0x4a, 0x82, 0xa1,
-  0x4a, 0x14, 0xa1, 0x50, 0x55, 0x05, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x50, 0x55, 0x05, 0x4a, 0x14, 0xa1, 0x4a, 0x14,
-  0xa1, 0x4a, 0x14, 0xa1, 0x4a, 0x82, 0xa1, 0x52,
-  0xaa, 0x85, 0x54, 0xaa, 0x15, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x02, 0xa1, 0x55, 0x4a, 0x85, 0x55, 0x2a, 0x15,
-  0x54, 0xa8, 0x55, 0x52, 0xa1, 0x55, 0x4a, 0x80,
-  0x05, 0x4a, 0xaa, 0xa1, 0x4a, 0xaa, 0xa1, 0x50,
-  0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x55, 0x2a,
-  0x85, 0x55, 0x2a, 0x85, 0x55, 0x28, 0x15, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x54, 0xa8, 0x55,
-  0x52, 0xa1, 0x55, 0x54, 0xa8, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x15, 0x55,
-  0x2a, 0x85, 0x55, 0x2a, 0x85, 0x55, 0x40, 0x15,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x41, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55,
-  0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x55, 0x28, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-  0x01, 0x55, 0x52, 0xa8, 0x55, 0x52, 0xa8, 0x55,
-  0x54, 0x28, 0x55, 0x55, 0x28, 0x55, 0x55, 0x28,
-  0x55, 0x55, 0x2a, 0x15, 0x55, 0x4a, 0x85, 0x55,
-  0x2a, 0x15, 0x55, 0x28, 0x55, 0x55, 0x28, 0x55,
-  0x54, 0x28, 0x55, 0x52, 0xa8, 0x55, 0x52, 0xa8,
-  0x55, 0x54, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
-  0x05, 0x55, 0x52, 0xa1, 0x45, 0x4a, 0xa8, 0x21,
-  0x48, 0x2a, 0xa1, 0x51, 0x4a, 0x85, 0x55, 0x50,
-  0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x56, 0x80, 0x82, 0x58, 0x00, 0x00, 0x58, 0x0a,
-  0x00, 0x60, 0x0a, 0x00, 0x80, 0x09, 0x80, 0x80,
-  0x09, 0x80, 0x80, 0x09, 0x80, 0x00, 0x09, 0x60,
-  0x00, 0x09, 0x5a, 0x00, 0x09, 0x55, 0x00, 0x09,
-  0x55, 0x00, 0x09, 0x55, 0x00, 0x09, 0x55, 0x00,
-  0x09, 0x55, 0x00, 0x09, 0x55, 0x00, 0x09, 0x6a,
-  0x80, 0x09, 0x80, 0x80, 0x09, 0x80, 0x80, 0x00,
-  0x26, 0x80, 0x00, 0x26, 0xa0, 0x00, 0x95, 0xa0,
-  0x00, 0x95, 0xa0, 0x00, 0x95, 0x98, 0x00, 0x26,
-  0x98, 0x00, 0x26, 0x98, 0x00, 0x26, 0x58, 0x00,
-  0x28, 0x56, 0x00, 0x08, 0x56, 0x00, 0x00, 0x56,
-  0x00, 0x00, 0x56, 0x00, 0x00, 0x55, 0x80, 0x00,
-  0x55, 0x80, 0x02, 0x55, 0x80, 0x02, 0x95, 0x80,
-  0x02, 0x95, 0x80, 0x02, 0x00, 0x96, 0x80, 0x00,
-  0x98, 0x00, 0x82, 0x58, 0x0a, 0x82, 0x60, 0x0a,
-  0x82, 0x80, 0x09, 0x09, 0x80, 0x09, 0x09, 0x80,
-  0x09, 0x0a, 0x00, 0x09, 0x26, 0x00, 0x09, 0x26,
-  0x00, 0x09, 0x26, 0x00, 0x09, 0x96, 0x00, 0x09,
-  0x96, 0x00, 0x09, 0x96, 0x00, 0x09, 0x56, 0x00,
-  0x09, 0x56, 0x00, 0x09, 0x55, 0x80, 0x09, 0x55,
-  0x80, 0x09, 0x82, 0x60, 0x00, 0x00, 0xa0, 0x00,
-  0x00, 0x98, 0x00, 0x00, 0x98, 0x00, 0x80, 0x98,
-  0x00, 0x80, 0x98, 0x00, 0x80, 0x98, 0x00, 0x60,
-  0x98, 0x00, 0x5a, 0x58, 0x00, 0x55, 0x58, 0x00,
-  0x55, 0x58, 0x00, 0x55, 0x58, 0x00, 0x55, 0x58,
-  0x00, 0x55, 0x58, 0x00, 0x55, 0x58, 0x00, 0xaa,
-  0x98, 0x00, 0x80, 0x98, 0x00, 0x80, 0x98, 0x00,
-  0x09, 0x55, 0x56, 0x09, 0x55, 0x58, 0x25, 0x55,
-  0x60, 0x25, 0x55, 0x80, 0x25, 0x55, 0x80, 0x25,
-  0x56, 0x00, 0x25, 0x56, 0x00, 0x25, 0x56, 0x00,
-  0x25, 0x58, 0x00, 0x25, 0x58, 0x00, 0x25, 0x58,
-  0x00, 0x25, 0x58, 0x00, 0x25, 0x58, 0x00, 0x25,
-  0x58, 0x00, 0x25, 0x58, 0x00, 0x25, 0x56, 0x00,
-  0x25, 0xaa, 0x00, 0x26, 0x02, 0x00, 0x80, 0x29,
-  0x56, 0x00, 0x02, 0x56, 0x0a, 0x00, 0x95, 0x25,
-  0x80, 0x25, 0x25, 0x80, 0x25, 0x25, 0x80, 0x09,
-  0x25, 0x80, 0x09, 0x25, 0x80, 0x09, 0x25, 0x80,
-  0x02, 0x25, 0x80, 0x02, 0x25, 0x80, 0x02, 0x25,
-  0x80, 0x02, 0x25, 0x80, 0x02, 0x25, 0x80, 0x02,
-  0x25, 0x80, 0x02, 0x25, 0x80, 0x09, 0x25, 0x80,
-  0x09, 0x25, 0x80, 0x09, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x80, 0x02, 0x80, 0x80, 0x02, 0x60,
-  0x80, 0x02, 0x60, 0x80, 0x02, 0x60, 0x80, 0x02,
-  0x60, 0x80, 0x02, 0x60, 0x80, 0x02, 0x60, 0x80,
-  0x02, 0x60, 0x80, 0x02, 0x60, 0x80, 0x02, 0x60,
-  0x80, 0x02, 0x80, 0x80, 0x00, 0x00, 0x80, 0x00,
-  0x02, 0x80, 0x02, 0xa9, 0x80, 0x02, 0x55, 0x80,
-  0x02, 0x55, 0x95, 0x55, 0x55, 0x25, 0x55, 0x55,
-  0x09, 0x55, 0x55, 0x02, 0x55, 0x55, 0x02, 0x55,
-  0x55, 0x00, 0x95, 0x55, 0x00, 0x95, 0x55, 0x00,
-  0x95, 0x55, 0x00, 0x95, 0x55, 0x00, 0x95, 0x55,
-  0x02, 0x55, 0x55, 0x02, 0x55, 0x55, 0x09, 0x55,
-  0x55, 0x25, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55,
-  0xaa, 0x55, 0x56, 0x00, 0x95, 0x56, 0x00, 0x95,
-  0x60, 0x09, 0x80, 0x60, 0x0a, 0x80, 0x58, 0x0a,
-  0x02, 0x58, 0x00, 0x09, 0x56, 0x80, 0x25, 0x55,
-  0x6a, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x56, 0xa9, 0x56, 0x58, 0x02,
-  0x58, 0x58, 0x02, 0x58, 0x58, 0x02, 0x58, 0x58,
-  0x02, 0x58, 0x56, 0xa9, 0x56, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x80,
-  0x02, 0x95, 0x80, 0x02, 0x55, 0x80, 0x02, 0x56,
-  0x00, 0x00, 0x56, 0x00, 0x00, 0x55, 0xaa, 0xaa,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0xa9, 0x56, 0xa9, 0x02, 0x58, 0x02, 0x02,
-  0x58, 0x02, 0x02, 0x58, 0x02, 0x02, 0x58, 0x02,
-  0xa9, 0x56, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x60, 0x09, 0x55,
-  0x60, 0x09, 0x55, 0x58, 0x0a, 0x55, 0x58, 0x00,
-  0x55, 0x56, 0x80, 0x55, 0x55, 0x6a, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56,
-  0xa9, 0x56, 0x58, 0x02, 0x58, 0x58, 0x02, 0x58,
-  0x58, 0x02, 0x58, 0x58, 0x02, 0x58, 0x56, 0xa9,
-  0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x80, 0x98, 0x00, 0x80, 0x98, 0x00,
-  0x02, 0x58, 0x00, 0x09, 0x60, 0x00, 0x25, 0x60,
-  0x00, 0x95, 0x5a, 0xaa, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x56, 0xa9,
-  0x02, 0x58, 0x02, 0x02, 0x58, 0x02, 0x02, 0x58,
-  0x02, 0x02, 0x58, 0x02, 0xa9, 0x56, 0xa9, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x26, 0x02, 0x80, 0x26, 0x02, 0x80, 0x28, 0x02,
-  0x60, 0x00, 0x09, 0x58, 0x00, 0x09, 0x56, 0xaa,
-  0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x56, 0xa9, 0x56, 0x58, 0x02,
-  0x58, 0x58, 0x02, 0x58, 0x58, 0x02, 0x58, 0x58,
-  0x02, 0x58, 0x56, 0xa9, 0x56, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0x80,
-  0x25, 0x25, 0x80, 0x25, 0x0a, 0x00, 0x95, 0x00,
-  0x02, 0x56, 0x80, 0x29, 0x56, 0x6a, 0x95, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0xa9, 0x56, 0xa9, 0x02, 0x58, 0x02, 0x02,
-  0x58, 0x02, 0x02, 0x58, 0x02, 0x02, 0x58, 0x02,
-  0xa9, 0x56, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x80, 0x02, 0x55, 0x80,
-  0x02, 0x55, 0x80, 0x02, 0x55, 0x00, 0x00, 0x95,
-  0x00, 0x00, 0x95, 0xaa, 0xaa, 0x55, 0x55, 0x56,
-  0xa9, 0x55, 0x58, 0x02, 0x55, 0x58, 0x02, 0x55,
-  0xa8, 0x02, 0x56, 0x00, 0x00, 0x56, 0x00, 0x00,
-  0x56, 0x00, 0x00, 0x56, 0x00, 0x00, 0x55, 0xa8,
-  0x02, 0x55, 0x58, 0x02, 0x55, 0x58, 0x02, 0x55,
-  0x56, 0xa9, 0x6a, 0x00, 0xa9, 0x80, 0x00, 0x02,
-  0x80, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00,
-  0x02, 0x6a, 0x00, 0xa9, 0x56, 0x00, 0x95, 0x56,
-  0x00, 0x95, 0x55, 0xaa, 0x55, 0xa5, 0x55, 0x55,
-  0x09, 0x55, 0x55, 0x09, 0x55, 0x55, 0x09, 0x55,
-  0x55, 0x09, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x80,
-  0x0a, 0x82, 0xa0, 0x02, 0x80, 0xa0, 0x00, 0x80,
-  0x20, 0x00, 0x80, 0x20, 0x02, 0x00, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x80, 0x02,
-  0x82, 0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0,
-  0x02, 0x82, 0x80, 0x02, 0x82, 0x80, 0x0a, 0xaa,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x02, 0x82, 0x80, 0x02,
-  0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0xaa, 0xa0,
-  0x0a, 0x28, 0xa0, 0x0a, 0x28, 0x00, 0x02, 0xaa,
-  0x80, 0x00, 0x28, 0xa0, 0x0a, 0x28, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x02, 0x80, 0x0a, 0x02, 0x80,
-  0x00, 0x0a, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x2a,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0xa8, 0x00, 0x00,
-  0xa0, 0x00, 0x02, 0xa0, 0x00, 0x02, 0x80, 0x00,
-  0x0a, 0x80, 0x00, 0x0a, 0x02, 0x80, 0x0a, 0x02,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xa8, 0x00, 0x02, 0xaa, 0x00, 0x02, 0x8a,
-  0x00, 0x02, 0x02, 0x00, 0x02, 0x82, 0x00, 0x02,
-  0x8a, 0x00, 0x00, 0xa8, 0x00, 0x02, 0xaa, 0x20,
-  0x0a, 0x8a, 0xa0, 0x0a, 0x0a, 0x80, 0x0a, 0x02,
-  0x80, 0x0a, 0x8a, 0xa0, 0x02, 0xa8, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00,
-  0x02, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x80,
-  0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xa0, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0xa0, 0x00, 0x02, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xaa, 0x80, 0x00, 0x28,
-  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xaa, 0x80, 0x02, 0xaa,
-  0x80, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0xa0, 0x00,
-  0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x02, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x80, 0x00, 0x02, 0x80, 0x00, 0x0a, 0x80, 0x00,
-  0x0a, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0xa8, 0x00, 0x00, 0xa0, 0x00, 0x02, 0xa0,
-  0x00, 0x02, 0x80, 0x00, 0x0a, 0x80, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x80,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0xa0,
-  0x02, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xa8,
-  0x00, 0x02, 0xa8, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xaa, 0x80, 0x02, 0xaa,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x00, 0x0a, 0x80,
-  0x00, 0x2a, 0x00, 0x00, 0xa8, 0x00, 0x02, 0xa0,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x00, 0x00, 0xa0,
-  0x00, 0x00, 0xa0, 0x00, 0xaa, 0x80, 0x00, 0xaa,
-  0x80, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x0a, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80,
-  0x00, 0x2a, 0x80, 0x00, 0xa2, 0x80, 0x02, 0x82,
-  0x80, 0x0a, 0x02, 0x80, 0x0a, 0xaa, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80,
-  0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0xa0, 0x0a, 0x00, 0x00, 0x0a, 0xaa, 0x80, 0x0a,
-  0xaa, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0xa0, 0x02, 0xaa,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0xaa, 0x80, 0x0a, 0xaa, 0x80, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00, 0x00, 0xa0,
-  0x00, 0x02, 0xa0, 0x00, 0x0a, 0x80, 0x00, 0x2a,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x80,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x02, 0xaa, 0x80, 0x02, 0xaa, 0x80, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0xa0,
-  0x02, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0xaa,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0xa0, 0x00, 0x00, 0xa0,
-  0x00, 0x00, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-  0x00, 0x0a, 0x00, 0x00, 0x28, 0x00, 0x00, 0xa0,
-  0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0xaa, 0x80, 0x02, 0xaa, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x80,
-  0x02, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x28, 0x00, 0x00, 0xa0,
-  0x00, 0x02, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa,
-  0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x02, 0xa0,
-  0x00, 0x0a, 0x80, 0x00, 0x2a, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0x80, 0x0a,
-  0x00, 0xa0, 0x28, 0x00, 0x28, 0x20, 0x00, 0x08,
-  0x20, 0xaa, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82,
-  0x08, 0x20, 0x8a, 0xa8, 0x20, 0xa8, 0xa0, 0x20,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x0a, 0x00, 0xa0,
-  0x02, 0xaa, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0x82, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0x00,
-  0x0a, 0xaa, 0x80, 0x0a, 0x02, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x0a,
-  0xaa, 0x80, 0x0a, 0xaa, 0x80, 0x0a, 0x02, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x02,
-  0xa0, 0x0a, 0xaa, 0x80, 0x0a, 0xaa, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x02, 0xaa,
-  0x80, 0x0a, 0x82, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x02,
-  0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0x00, 0x0a, 0xaa, 0x80, 0x0a,
-  0x02, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0xaa, 0x00, 0x0a, 0xaa, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0xaa, 0x00, 0x0a, 0xaa, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xaa, 0x00, 0x0a, 0xaa,
-  0x80, 0x0a, 0x82, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x0a, 0xa0, 0x0a, 0x0a, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0xa0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x02, 0xaa, 0x80, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xaa, 0x80, 0x02, 0xaa,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xa0,
-  0x00, 0x2a, 0xa0, 0x00, 0x02, 0x80, 0x00, 0x02,
-  0x80, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00,
-  0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80,
-  0x00, 0x02, 0x80, 0x0a, 0x02, 0x80, 0x0a, 0x02,
-  0x80, 0x0a, 0xaa, 0x80, 0x02, 0xaa, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x02, 0x80, 0x0a, 0x02, 0x80, 0x0a,
-  0x0a, 0x00, 0x0a, 0x0a, 0x00, 0x0a, 0xa8, 0x00,
-  0x0a, 0x28, 0x00, 0x0a, 0x0a, 0x00, 0x0a, 0x0a,
-  0x00, 0x0a, 0x02, 0x80, 0x0a, 0x02, 0x80, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0x28,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x80,
-  0xa0, 0x0a, 0x80, 0xa0, 0x0a, 0xa0, 0xa0, 0x0a,
-  0xa8, 0xa0, 0x0a, 0x2a, 0xa0, 0x0a, 0x0a, 0xa0,
-  0x0a, 0x02, 0xa0, 0x0a, 0x02, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x02, 0xaa,
-  0x80, 0x0a, 0x82, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x02,
-  0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0x00, 0x0a, 0xaa, 0x80, 0x0a,
-  0x02, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x02, 0xa0, 0x0a, 0xaa, 0x80, 0x0a, 0xaa,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0x82, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0x2a, 0xa0,
-  0x0a, 0x8a, 0x80, 0x02, 0xaa, 0xa0, 0x00, 0xa8,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0x00,
-  0x0a, 0xaa, 0x80, 0x0a, 0x02, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x0a,
-  0xaa, 0x80, 0x0a, 0xa8, 0x00, 0x0a, 0xa8, 0x00,
-  0x0a, 0x2a, 0x00, 0x0a, 0x0a, 0x80, 0x0a, 0x02,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x02, 0xaa,
-  0x80, 0x0a, 0x82, 0xa0, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x80, 0x00, 0x02, 0xa8, 0x00,
-  0x00, 0x2a, 0x80, 0x00, 0x02, 0xa0, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x02,
-  0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x82, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0xaa,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x82, 0xa0, 0x02, 0x82, 0x80, 0x02, 0xaa,
-  0x80, 0x00, 0xaa, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0x28, 0xa0,
-  0x0a, 0x28, 0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0x28,
-  0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0xaa, 0xa0, 0x02,
-  0xaa, 0x80, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x02, 0x82, 0x80,
-  0x00, 0xaa, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0xaa, 0x00, 0x02, 0x82, 0x80, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x82,
-  0xa0, 0x02, 0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x00, 0x00, 0xa0, 0x00, 0x00,
-  0xa0, 0x00, 0x02, 0xa0, 0x00, 0x0a, 0x80, 0x00,
-  0x2a, 0x00, 0x00, 0xa8, 0x00, 0x02, 0xa0, 0x00,
-  0x0a, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-  0x80, 0x00, 0x2a, 0x80, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x2a, 0x80, 0x00, 0x2a, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0xa8, 0x00, 0x02, 0xa8, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xa8, 0x00, 0x02, 0xa8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0xaa, 0x00, 0x02, 0x82,
-  0x80, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xa8, 0x2a,
-  0xaa, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x02, 0x80, 0x00, 0x00, 0xa0, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x02, 0xaa,
-  0x80, 0x0a, 0x82, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0x80, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0x00,
-  0x0a, 0xaa, 0x80, 0x0a, 0x02, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0xa0, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0xaa, 0x00, 0x0a, 0xaa, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0x80, 0xa0,
-  0x0a, 0x00, 0x00, 0x0a, 0x0a, 0xa0, 0x0a, 0x0a,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x80, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xaa,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x2a, 0xa0, 0x00, 0x2a, 0xa0, 0x00,
-  0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80,
-  0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x02, 0x82,
-  0x80, 0x02, 0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xa0, 0x0a, 0x02, 0xa0, 0x0a, 0x0a, 0x80,
-  0x0a, 0x2a, 0x00, 0x0a, 0xa8, 0x00, 0x0a, 0xa8,
-  0x00, 0x0a, 0xaa, 0x00, 0x0a, 0x0a, 0x80, 0x0a,
-  0x02, 0xa0, 0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x82,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0x28, 0xa0, 0x0a,
-  0x28, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x80, 0xa0, 0x0a, 0xa0, 0xa0, 0x0a, 0xa8, 0xa0,
-  0x0a, 0x2a, 0xa0, 0x0a, 0x0a, 0xa0, 0x0a, 0x02,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0x80,
-  0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0x80, 0x0a,
-  0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0xaa,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x0a, 0xa0,
-  0x0a, 0x0a, 0x80, 0x0a, 0xaa, 0xa0, 0x02, 0xa8,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0x80,
-  0x0a, 0xa8, 0x00, 0x0a, 0x2a, 0x00, 0x0a, 0x0a,
-  0x80, 0x0a, 0x02, 0xa0, 0x0a, 0x00, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xaa, 0x80, 0x0a, 0xaa, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0x00, 0x0a, 0xaa, 0x80, 0x02, 0xaa,
-  0xa0, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0xaa, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xaa, 0xa0,
-  0x0a, 0xaa, 0xa0, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0xaa, 0xa0, 0x02, 0xaa,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x02, 0xaa,
-  0x80, 0x00, 0xaa, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0,
-  0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x28,
-  0xa0, 0x0a, 0x28, 0xa0, 0x0a, 0xaa, 0xa0, 0x02,
-  0xaa, 0x80, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0,
-  0x0a, 0x82, 0xa0, 0x02, 0xaa, 0x80, 0x00, 0xaa,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0xaa, 0x00, 0x02, 0xaa, 0x80, 0x0a, 0x82, 0xa0,
-  0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x0a, 0x00,
-  0xa0, 0x0a, 0x00, 0xa0, 0x0a, 0x82, 0xa0, 0x02,
-  0xaa, 0x80, 0x00, 0xaa, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00,
-  0x02, 0xa0, 0x00, 0x0a, 0x80, 0x00, 0x2a, 0x00,
-  0x00, 0xa8, 0x00, 0x02, 0xa0, 0x00, 0x0a, 0x80,
-  0x00, 0x0a, 0xaa, 0xa0, 0x0a, 0xaa, 0xa0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-  0x80, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0xa8, 0x00,
-  0x02, 0xa0, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x2a, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0xa8, 0x00, 0x02, 0xa8, 0x00,
-  0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-  0x00, 0x00, 0x2a, 0x00, 0x00, 0x0a, 0x80, 0x00,
-  0x2a, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x28, 0x00, 0x02, 0xa8, 0x00, 0x02, 0xa8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0xa0, 0x00, 0x0a, 0xa8, 0x20,
-  0x08, 0x2a, 0xa0, 0x00, 0x0a, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
+ *******************************************************************************/
 
 /*******************************************************************************
    Includes
  *******************************************************************************/
 #include "max7456.h"
+#include "font.h"
+#include "uart.h"
 #include <SPI.h>
 #include <EEPROM.h>
+#include <util/crc16.h>
 
 /*******************************************************************************
-  Minimosd Display Protocol Definition v1.0
-   Formal definition for the display protocol: (Token[Command[Param]])*
+  Minimosd Display Protocol Definition v1.1
+   Formal definition for the display protocol: (Token[Command[Param*]])*
    Tokens,  commands and params are all bytes.
    All tokens except 0 results in the corresponding character in the Max7456
    charmap being displayed onscreen  att current position using current params.
    The token 255 signals that the next byte is a command.
-   Some commands have a single param.
-   Some commands result in a single byte answer.
+   Some commands have one or more params. Params are never 255.
    Invalid characters are ignored (e.g. unknown commands, params that are out of
    bounds, etc).
+   The MinimOSD answers with status frames on its TX line, see below.
  *******************************************************************************
   Protocol Commands:
  *******************************************************************************/
@@ -1803,19 +73,150 @@ const char tableOfAllCharacters[13824] PROGMEM = {
 #define CMD_NEWLINE         13  /* Moves cursor to start of the next line      */
 #define CMD_SET_X           14  /* Position X cursor (next char is a parameter)*/
 #define CMD_SET_Y           15  /* Position Y cursor (next char is a parameter)*/
+#define CMD_INFO_LINE       16  /* Draw the info line (7 params, see below)    */
+#define CMD_DRAW_TEMPLATE   17  /* Draw template (params: id, x, y)            */
+#define CMD_LOAD_TEMPLATES  18  /* Store templates (5 params + data, see below)*/
+#define CMD_SET_LOS_MODE    19  /* Loss of sync display (param: LOS_xxx)       */
+#define CMD_DUMP_SCREEN     20  /* Print the screen as text on the TX line     */
+#define CMD_SEND_COUNTERS   21  /* Answer with a counters frame, see below     */
+#define CMD_SURVEY_DATA     22  /* Survey data (2 params + data, see below)    */
+#define MAX_COMMAND         CMD_SURVEY_DATA
+/*******************************************************************************
+  Loss of Sync Modes:
+   The MinimOSD watches the video sync itself and covers the screen with a
+   warning while sync is lost. The previous screen returns with the sync.
+ *******************************************************************************/
+#define LOS_NONE            0   /* No loss of sync display                     */
+#define LOS_WARNING         1   /* Blinking warning text                       */
+#define LOS_GRAY            2   /* Warning text on a gray background           */
+/*******************************************************************************
+  Info Line Packet:
+   The params of CMD_INFO_LINE are raw values. All params are 7 bit values.
+   The MinimOSD formats the values and places the info line on screen itself.
+ *******************************************************************************/
+#define INFO_LINE_PARAMS    7   /* Number of params in an info line packet     */
+#define INFO_CHANNEL        0   /* Channel position in frequency table (0-47)  */
+#define INFO_FREQUENCY_HI   1   /* Frequency in MHz, bits 7-13                 */
+#define INFO_FREQUENCY_LO   2   /* Frequency in MHz, bits 0-6                  */
+#define INFO_RSSI_HI        3   /* Raw RSSI value, bits 7-13                   */
+#define INFO_RSSI_LO        4   /* Raw RSSI value, bits 0-6                    */
+#define INFO_BATTERY        5   /* Battery level in percent (0-99)             */
+#define INFO_FLAGS          6   /* Layout flags, see below                     */
+
+#define INFO_FLAG_LEFT      0x01 /* Info line on the left side of the screen   */
+#define INFO_FLAG_BAT_TEXT  0x02 /* Show battery percentage as text            */
+
+#define MAX_PARAMS          INFO_LINE_PARAMS  /* Longest param list            */
+/*******************************************************************************
+  Screen Templates:
+   Static screen parts are stored as templates in EEPROM and are drawn with
+   CMD_DRAW_TEMPLATE. A template is a byte stream in the display protocol
+   format. CMD_SET_X and CMD_SET_Y in a template are relative to the x and y
+   params of CMD_DRAW_TEMPLATE.
+   CMD_LOAD_TEMPLATES params: 16 bit CRC of the template image as 2+7+7 bits,
+   image length as 7+7 bits. The image follows as raw bytes.
+   Image format: template count, count+1 little endian 16 bit offsets to the
+   start of each template (the last offset is the image length), templates.
+ *******************************************************************************/
+#define LOAD_TEMPLATES_PARAMS 5
+#define TEMPLATE_HASH_NONE  0xFFFF  /* No valid templates stored in EEPROM     */
+/*******************************************************************************
+  Survey Data:
+   Survey frames are logged by tapping the CYCLOP++ TX line and are skipped.
+   CMD_SURVEY_DATA params: frame length as 7+7 bits. The frame follows as raw
+   bytes.
+ *******************************************************************************/
+#define SURVEY_DATA_PARAMS  2
+/*******************************************************************************
+  Status Frames (MinimOSD to CYCLOP++):
+   Format: STATUS_START, frame type, params. Params are 7 bit values.
+   Status frames are sent periodically and as soon as a quarter of the receive
+   buffer has been consumed. The sender may have at most STATUS_BUFFER_SIZE
+   bytes in flight, i.e. sent but not yet counted in STATUS_CONSUMED or
+   STATUS_OVERFLOWS. The counters start at 0 when the MinimOSD boots, which
+   the sender sees as a new STATUS_EPOCH.
+   A counters frame is sent as the answer to CMD_SEND_COUNTERS. Counters are
+   21 bit values sent as 3 params, bits 14-20 first. They wrap around.
+ *******************************************************************************/
+#define STATUS_START        255 /* Start of a status frame                     */
+#define STATUS_FRAME        1   /* Frame type: flow control and status         */
+#define STATUS_PARAMS       11  /* Number of params in a status frame          */
+#define STATUS_CONSUMED_HI  0   /* Bytes consumed, 14 bit counter, bits 7-13   */
+#define STATUS_CONSUMED_LO  1   /* Bytes consumed, 14 bit counter, bits 0-6    */
+#define STATUS_BUFFER_SIZE  2   /* Receive buffer size / 8                     */
+#define STATUS_VIDEO        3   /* Active video format: VIDEO_NTSC or VIDEO_PAL*/
+#define STATUS_OVERFLOWS_HI 4   /* Lost received bytes, 14 bit counter, 7-13   */
+#define STATUS_OVERFLOWS_LO 5   /* Lost received bytes, 14 bit counter, 0-6    */
+#define STATUS_TEMPLATE_HI  6   /* CRC of stored templates, bits 14-15         */
+#define STATUS_TEMPLATE_MID 7   /* CRC of stored templates, bits 7-13          */
+#define STATUS_TEMPLATE_LO  8   /* CRC of stored templates, bits 0-6           */
+#define STATUS_EPOCH        9   /* Boots modulo 128, new when counters restart */
+#define STATUS_CHECK        10  /* XOR of the frame type and params 0-9        */
+
+#define STATUS_COUNTERS     2   /* Frame type: profiling counters              */
+#define COUNTERS_PARAMS     16  /* Number of params in a counters frame        */
+#define COUNTERS_RX_BYTES   0   /* Bytes received                              */
+#define COUNTERS_OVERFLOWS  3   /* Lost received bytes                         */
+#define COUNTERS_SPI_BYTES  6   /* Bytes transferred to and from the max7456   */
+#define COUNTERS_BUSY_WAIT  9   /* Time spent waiting for the max7456 in ms    */
+#define COUNTERS_MAX_CELLS  12  /* Most cells written in a field since the     */
+                                /* previous counters frame                     */
+#define COUNTERS_CHECK      15  /* XOR of the frame type and params 0-14       */
+
+#define STATUS_INTERVAL_MS  20  /* Maximum time between status frames          */
+#define VIDEO_INTERVAL_MS   100 /* Time between video format checks            */
+#define VIDEO_SWITCH_READS  5   /* Equal checks needed to switch video format  */
+/*******************************************************************************
+   Info Line Layout (mirrors the CYCLOP++ screen layout)
+ *******************************************************************************/
+#define BATTERY_TEXT_WIDTH           4  // 3 digits + %
+#define BATTERY_SYMBOL_X_OFFSET_LEFT 2  // Battery symbol to text on the left
+#define INFO_LINE_RIGHT_X            12 // Text start on the right info line
+#define INFO_LINE_LEFT_X             1  // Battery start on the left info line
+#define BATTERY_RIGHT_X              25 // Battery position on the right
+/*******************************************************************************
+   Character constants
+ *******************************************************************************/
+#define OSD_BATTERY_100     0x01
+#define OSD_BATTERY_75      0x02
+#define OSD_BATTERY_50      0x03
+#define OSD_BATTERY_25      0x04
+#define OSD_BATTERY_0       0x05
+#define OSD_ANTENNA         0x0C
+#define OSD_MHZ             0x0D
+#define OSD_SPACE           0x20
 /*******************************************************************************
    Hardware Defines
  *******************************************************************************/
 #define CS_PIN      6   // SPI Chip Select pin connected to Max7456
-#define MAX_LINES   13  // For both NTSC and PAL
+#define VSYNC_PIN   2   // ~VSYNC output of the Max7456 (INT0)
+#define NTSC_LINES  13  // Visible lines in NTSC
+#define PAL_LINES   16  // Visible lines in PAL
+#define SCREEN_COLUMNS      30
+#define SCREEN_LINES        16  // Max7456 display memory holds 16 lines
+#define SCREEN_CELLS        (SCREEN_COLUMNS * SCREEN_LINES)
+#define MAX_CELLS_PER_FIELD 240 // Cells written to the Max7456 per field
+#define FIELD_TIMEOUT_MS    40  // Commit without ~VSYNC, e.g. if not wired
+#define LOS_TEXT    "no signal" // Loss of sync warning, centered on screen
+#define LOS_TEXT_X  ((SCREEN_COLUMNS - sizeof(LOS_TEXT) + 1) / 2)
 #define VIDEO_NONE  2   // No video format
 #define VIDEO_PAL   1   // PAL video format
 #define VIDEO_NTSC  0   // NTSC video format
+/*******************************************************************************
+   Debug. With BOOT_REPORT the MinimOSD prints boot figures as text on its TX
+   line. Status frames start with 255 and CYCLOP++ skips other bytes, so the
+   text is harmless, but it costs boot time and flash.
+ *******************************************************************************/
+//#define BOOT_REPORT
 
 /*******************************************************************************
-   EEPROM addresses
+   EEPROM addresses. The template image takes the rest of the EEPROM.
  *******************************************************************************/
-#define EEPROM_CHARSET_LOADED 0
+#define EEPROM_CHARSET_HASH   0       // 2 bytes, CRC of the loaded font table
+#define EEPROM_BOOT_EPOCH     2       // 1 byte, boots counted modulo 128
+#define EEPROM_TEMPLATE_HASH  3       // 2 bytes, CRC of the template image
+#define EEPROM_TEMPLATES      5       // Template image
+#define EEPROM_SIZE           1024
 
 /*******************************************************************************
    max7456 state variables. It is OK to use state values , but do not set them
@@ -1829,10 +230,104 @@ bool inVideoState = true;
 
 uint8_t curX = 0;        // May be directly manipulated
 uint8_t curY = 0;        // May be directly manipulated
+uint8_t originX = 0;     // Cursor origin, only set while drawing templates
+uint8_t originY = 0;     // Cursor origin, only set while drawing templates
+
+/*******************************************************************************
+   Back buffer. All drawing goes to a copy of the display memory in RAM.
+   Changed cells are marked dirty and written to the max7456 in auto-increment
+   bursts at the start of each field, so that large updates do not tear.
+ *******************************************************************************/
+#define ATTR_BLINK    0x01
+#define ATTR_INVERSE  0x02
+
+byte screenChars[SCREEN_CELLS];
+byte screenAttrs[SCREEN_CELLS / 4];   // 2 bits per cell, ATTR_xxx
+byte screenDirty[SCREEN_CELLS / 8];   // 1 bit per cell
+bool screenClearPending = false;      // Clear the display memory at commit
+bool screenClearing = false;          // Display memory clear started, cells not yet written
+volatile bool fieldStart = false;     // Set by the ~VSYNC interrupt
+unsigned int cellsPerField = 0;       // Cells written at the last commit
+unsigned int maxCellsPerField = 0;    // Most cells written since the last counters frame
+
+/*******************************************************************************
+   Loss of sync overlay. The warning is written straight to the max7456.
+   Back buffer cells under it are left dirty until the sync returns.
+ *******************************************************************************/
+byte losMode = LOS_WARNING;           // LOS_xxx
+bool losShown = false;                // The warning is on screen
+unsigned int overlayStart = 0;        // First cell under the warning
+unsigned int overlayEnd = 0;          // First cell after the warning
+
+/*******************************************************************************
+   Protocol parser. The parser is a state machine driven by parserActions,
+   which holds the action for each parser mode and kind of input byte.
+   The serial stream and templates use separate states.
+ *******************************************************************************/
+#define PARSE_TEXT          0   // Bytes are characters to print
+#define PARSE_COMMAND       1   // Last byte was CMD_CMD
+#define PARSE_PARAMS        2   // Collecting the params of a command
+#define PARSE_RAW           3   // Raw data, never interpreted
+
+#define ACTION_PRINT        0   // Print the byte
+#define ACTION_ESCAPE       1   // CMD_CMD, the next byte is a command
+#define ACTION_COMMAND      2   // Byte is a command
+#define ACTION_PARAM        3   // Byte is a param of the current command
+#define ACTION_RAW          4   // Byte is raw data of the current command
+
+const byte parserActions[4][2] PROGMEM = {
+  // Other byte      CMD_CMD
+  { ACTION_PRINT,    ACTION_ESCAPE },   // PARSE_TEXT
+  { ACTION_COMMAND,  ACTION_ESCAPE },   // PARSE_COMMAND
+  { ACTION_PARAM,    ACTION_ESCAPE },   // PARSE_PARAMS, CMD_CMD aborts params
+  { ACTION_RAW,      ACTION_RAW    }    // PARSE_RAW
+};
+
+// Number of params of each command, unknown commands have none
+const byte commandParams[MAX_COMMAND + 1] PROGMEM = {
+  0,                                    // 0 is not a command
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // CMD_LOAD_CHARS - CMD_NEWLINE
+  1,                                    // CMD_SET_X
+  1,                                    // CMD_SET_Y
+  INFO_LINE_PARAMS,                     // CMD_INFO_LINE
+  3,                                    // CMD_DRAW_TEMPLATE
+  LOAD_TEMPLATES_PARAMS,                // CMD_LOAD_TEMPLATES
+  1,                                    // CMD_SET_LOS_MODE
+  0,                                    // CMD_DUMP_SCREEN
+  0,                                    // CMD_SEND_COUNTERS
+  SURVEY_DATA_PARAMS                    // CMD_SURVEY_DATA
+};
+
+struct ParserState {
+  byte mode;                    // PARSE_xxx
+  byte command;                 // Command waiting for params
+  byte paramCount;              // Number of params received
+  byte params[MAX_PARAMS];
+  unsigned int rawRemaining;    // Raw data bytes left of the current command
+};
+
+void parseByte( ParserState &state, byte inChar );
+void runCommand( ParserState &state );
+void executeCommand( ParserState &state, byte command, const byte *params );
+void sendStatus( void );
+unsigned int readTemplateHash( void );
+void drawLosWarning( void );
+void loadCharSet( void );
+
+/*******************************************************************************
+   Template upload state
+ *******************************************************************************/
+unsigned int templateUploadHash = TEMPLATE_HASH_NONE;
+unsigned int templateUploadCrc = 0xFFFF;
+unsigned int templateUploadOffset = 0;
+bool templateUploadSkip = false;
 /*******************************************************************************
    Other Global Variables
  *******************************************************************************/
 Max7456 osd;
+byte videoFormat = VIDEO_NTSC;      // Active video format, set by init
+byte screenLines = NTSC_LINES;      // Visible lines in the active format
+byte bootEpoch = 0;                 // STATUS_EPOCH of this boot
 
 /*******************************************************************************
    Function: setBlinkState
@@ -1900,18 +395,142 @@ void setInVideoState( bool newState )
   }
 }
 
+/*******************************************************************************
+   Function: trackVideoFormat
+           : feeds a detected video format to the format tracker. The active
+           : format only changes after VIDEO_SWITCH_READS detections in a row
+           : of the same other format, so weak signals do not make it flap.
+           : returns true if the active format changed
+ *******************************************************************************/
+bool trackVideoFormat( byte detected )
+{
+  static byte candidate = VIDEO_NONE;
+  static byte count = 0;
+
+  if (detected == videoFormat) {
+    count = 0;
+    return false;
+  }
+  if (detected != candidate) {
+    candidate = detected;
+    count = 0;
+  }
+  if ((detected == VIDEO_NONE) || (++count < VIDEO_SWITCH_READS))
+    return false;
+
+  count = 0;
+  videoFormat = detected;
+  screenLines = (videoFormat == VIDEO_PAL) ? PAL_LINES : NTSC_LINES;
+  return true;
+}
+
 /*******************************************************************************
    Function: updateVideoFormat
            : checks the incomming video format.
-           : switches OSD video format if it differs from invideo format
-           : if neither PAL or NTSC is detected, the OSD video format remains
-           : unchanged.
+           : switches OSD video format when the format tracker says so and
+           : tells CYCLOP++ about the new format at once.
  *******************************************************************************/
 void updateVideoFormat( void )
 {
-  byte videoFormat = osd.getInVideoFormat();
-  if (( videoFormat == VIDEO_PAL ) || ( videoFormat == VIDEO_NTSC ))
+  if (trackVideoFormat( osd.getInVideoFormat() )) {
     osd.setOutVideoFormat( videoFormat );
+    sendStatus();
+  }
+}
+
+/*******************************************************************************
+   Function: sendStatus
+           : sends a status frame to CYCLOP++. Skipped if there is no room
+           : in the transmit buffer, the next frame carries the same data.
+ *******************************************************************************/
+void sendStatus( void )
+{
+  byte frame[STATUS_PARAMS];
+  unsigned int consumed = uart.readCount();    // Only the low 14 bits are sent
+  unsigned int overflows = uart.overflows();   // Only the low 14 bits are sent
+  unsigned int templateHash = readTemplateHash();
+  byte check = STATUS_FRAME;
+  byte i;
+
+  if (uart.availableForWrite() < STATUS_PARAMS + 2)
+    return;
+
+  frame[STATUS_CONSUMED_HI] = (consumed >> 7) & 0x7F;
+  frame[STATUS_CONSUMED_LO] = consumed & 0x7F;
+  frame[STATUS_BUFFER_SIZE] = UART_RX_BUFFER_SIZE / 8 - 1;  // The ring holds one byte less
+  frame[STATUS_VIDEO] = videoFormat;
+  frame[STATUS_OVERFLOWS_HI] = (overflows >> 7) & 0x7F;
+  frame[STATUS_OVERFLOWS_LO] = overflows & 0x7F;
+  frame[STATUS_TEMPLATE_HI] = templateHash >> 14;
+  frame[STATUS_TEMPLATE_MID] = (templateHash >> 7) & 0x7F;
+  frame[STATUS_TEMPLATE_LO] = templateHash & 0x7F;
+  frame[STATUS_EPOCH] = bootEpoch;
+  for (i = 0; i < STATUS_CHECK; i++)
+    check ^= frame[i];
+  frame[STATUS_CHECK] = check;
+
+  uart.write( STATUS_START );
+  uart.write( STATUS_FRAME );
+  uart.write( frame, STATUS_PARAMS );
+}
+
+/*******************************************************************************
+   Function: putCounter
+           : stores the low 21 bits of a counter as 3 params, high bits first
+ *******************************************************************************/
+void putCounter( byte *params, unsigned long value )
+{
+  params[0] = (value >> 14) & 0x7F;
+  params[1] = (value >> 7) & 0x7F;
+  params[2] = value & 0x7F;
+}
+
+/*******************************************************************************
+   Function: sendCounters
+           : sends a counters frame to CYCLOP++. Skipped if there is no room
+           : in the transmit buffer, CYCLOP++ asks again.
+ *******************************************************************************/
+void sendCounters( void )
+{
+  byte frame[COUNTERS_PARAMS];
+  byte check = STATUS_COUNTERS;
+  byte i;
+
+  if (uart.availableForWrite() < COUNTERS_PARAMS + 2)
+    return;
+
+  putCounter( frame + COUNTERS_RX_BYTES, uart.readCount() );
+  putCounter( frame + COUNTERS_OVERFLOWS, uart.overflows() );
+  putCounter( frame + COUNTERS_SPI_BYTES, osd.getSpiBytes() );
+  putCounter( frame + COUNTERS_BUSY_WAIT, osd.getBusyWaitTime() / 1000 );
+  putCounter( frame + COUNTERS_MAX_CELLS, maxCellsPerField );
+  maxCellsPerField = 0;
+  for (i = 0; i < COUNTERS_CHECK; i++)
+    check ^= frame[i];
+  frame[COUNTERS_CHECK] = check;
+
+  uart.write( STATUS_START );
+  uart.write( STATUS_COUNTERS );
+  uart.write( frame, COUNTERS_PARAMS );
+}
+
+/*******************************************************************************
+   Function: updateStatus
+           : sends a status frame when it is time for one. Frequent frames
+           : are needed while data is being consumed to keep the sender going.
+ *******************************************************************************/
+void updateStatus( void )
+{
+  static unsigned long statusTimer = 0;
+  static unsigned int lastConsumed = 0;
+  unsigned int consumed = uart.readCount();
+
+  if ((millis() - statusTimer >= STATUS_INTERVAL_MS) ||
+      ((consumed - lastConsumed) >= UART_RX_BUFFER_SIZE / 4)) {
+    statusTimer = millis();
+    lastConsumed = consumed;
+    sendStatus();
+  }
 }
 
 /*******************************************************************************
@@ -1921,28 +540,610 @@ void updateVideoFormat( void )
 void newLine( void ) {
   curX = 0;
   curY++;
-  if ( curY >= MAX_LINES )
+  if ( curY >= screenLines )
     curY = 0;
 }
 
+/*******************************************************************************
+   Function: cellAttr
+           : returns the attributes of a back buffer cell
+ *******************************************************************************/
+byte cellAttr( unsigned int address )
+{
+  return (screenAttrs[address >> 2] >> ((address & 3) * 2)) & 3;
+}
+
+/*******************************************************************************
+   Function: isDirty
+ *******************************************************************************/
+bool isDirty( unsigned int address )
+{
+  return screenDirty[address >> 3] & (1 << (address & 7));
+}
+
+/*******************************************************************************
+   Function: setCell
+           : writes a character to the back buffer. The cell is only marked
+           : dirty if the character or its attributes change.
+ *******************************************************************************/
+void setCell( unsigned int address, byte c, byte attr )
+{
+  byte shift = (address & 3) * 2;
+
+  if ((address >= SCREEN_CELLS) || ((screenChars[address] == c) && (cellAttr(address) == attr)))
+    return;
+  screenChars[address] = c;
+  screenAttrs[address >> 2] = (screenAttrs[address >> 2] & ~(3 << shift)) | (attr << shift);
+  screenDirty[address >> 3] |= 1 << (address & 7);
+}
+
+/*******************************************************************************
+   Function: clearBackBuffer
+           : empties the back buffer. The display memory is cleared by the
+           : max7456 at the next commit, so only cells drawn after the clear
+           : have to be written.
+ *******************************************************************************/
+void clearBackBuffer( void )
+{
+  memset( screenChars, 0, sizeof(screenChars) );
+  memset( screenAttrs, 0, sizeof(screenAttrs) );
+  memset( screenDirty, 0, sizeof(screenDirty) );
+  screenClearPending = true;
+}
+
+/*******************************************************************************
+   Function: commitScreen
+           : writes dirty cells to the max7456. Cells with contiguous addresses
+           : and the same attributes are written in one auto-increment burst.
+           : Cells beyond MAX_CELLS_PER_FIELD are left for the next field.
+           : A pending clear is only started here. The cells are written by
+           : the next commit, which the loop runs as soon as the clear is done.
+ *******************************************************************************/
+void commitScreen( void )
+{
+  unsigned int address = 0;
+  unsigned int start;
+  unsigned int cells = 0;
+  byte attr;
+
+  if (screenClearPending) {
+    osd.startClearScreen();
+    screenClearPending = false;
+    screenClearing = true;
+    return;
+  }
+  if (screenClearing) {
+    screenClearing = false;
+    if (losShown)
+      drawLosWarning();
+  }
+  while ((address < SCREEN_CELLS) && (cells < MAX_CELLS_PER_FIELD)) {
+    if ((address >= overlayStart) && (address < overlayEnd)) {
+      address = overlayEnd;       // Cells under the warning stay dirty
+      continue;
+    }
+    if (!(address & 7) && !screenDirty[address >> 3]) {
+      address += 8;               // Skip 8 clean cells at once
+      continue;
+    }
+    if (!isDirty(address)) {
+      address++;
+      continue;
+    }
+    start = address;
+    attr = cellAttr(address);
+    do {
+      screenDirty[address >> 3] &= ~(1 << (address & 7));
+      address++;
+      cells++;
+    } while ((address < SCREEN_CELLS) && (cells < MAX_CELLS_PER_FIELD) &&
+             (address != overlayStart) && isDirty(address) && (cellAttr(address) == attr));
+    osd.printMax7456Chars( screenChars + start, address - start,
+                           start % SCREEN_COLUMNS, start / SCREEN_COLUMNS,
+                           (attr & ATTR_BLINK) ? 1 : 0, (attr & ATTR_INVERSE) ? 1 : 0 );
+  }
+  cellsPerField = cells;
+  if (cells > maxCellsPerField)
+    maxCellsPerField = cells;
+}
+
+/*******************************************************************************
+   Function: drawLosWarning
+           : writes the loss of sync warning to the max7456
+ *******************************************************************************/
+void drawLosWarning( void )
+{
+  osd.print( F(LOS_TEXT), overlayStart % SCREEN_COLUMNS, overlayStart / SCREEN_COLUMNS, 1, 0 );
+}
+
+/*******************************************************************************
+   Function: showLosOverlay
+           : covers the middle of the screen with the loss of sync warning
+ *******************************************************************************/
+void showLosOverlay( void )
+{
+  overlayStart = SCREEN_COLUMNS * (screenLines / 2) + LOS_TEXT_X;
+  overlayEnd = overlayStart + sizeof(LOS_TEXT) - 1;
+  drawLosWarning();
+  if (losMode == LOS_GRAY)
+    osd.setGrayBackground( true );
+  losShown = true;
+}
+
+/*******************************************************************************
+   Function: hideLosOverlay
+           : removes the loss of sync warning. The cells under it are marked
+           : dirty, so the next commit restores the back buffer content.
+ *******************************************************************************/
+void hideLosOverlay( void )
+{
+  unsigned int address;
+
+  for (address = overlayStart; address < overlayEnd; address++)
+    screenDirty[address >> 3] |= 1 << (address & 7);
+  overlayStart = 0;
+  overlayEnd = 0;
+  if (losMode == LOS_GRAY)
+    osd.setGrayBackground( false );
+  losShown = false;
+}
+
+/*******************************************************************************
+   Function: updateLossOfSync
+           : shows or hides the loss of sync warning. Called once per field,
+           : so the warning appears within a field of the max7456 detecting
+           : the loss. Ignored while the input video is turned off.
+ *******************************************************************************/
+void updateLossOfSync( void )
+{
+  bool lost = (losMode != LOS_NONE) && inVideoState && osd.lossOfSync();
+
+  if (lost && !losShown)
+    showLosOverlay();
+  else if (!lost && losShown)
+    hideLosOverlay();
+}
+
+/*******************************************************************************
+   Function: setLosMode
+           : selects how loss of sync is shown. A shown warning is removed
+           : and comes back in the new mode at the next field.
+ *******************************************************************************/
+void setLosMode( byte mode )
+{
+  if (mode > LOS_GRAY)
+    return;
+  if (losShown)
+    hideLosOverlay();
+  losMode = mode;
+}
+
+/*******************************************************************************
+   Function: vsyncInterrupt
+           : a new field starts, it is time to commit the back buffer
+ *******************************************************************************/
+void vsyncInterrupt( void )
+{
+  fieldStart = true;
+}
+
+/*******************************************************************************
+   Function: printChar
+           : prints a character at the cursor position using the current
+           : blink, inverse and fill states. The cursor is moved forward.
+ *******************************************************************************/
+void printChar( byte inChar )
+{
+  setCell( SCREEN_COLUMNS * curY + curX,
+           fillState && (inChar > 31) && (inChar < 128) ? inChar + 0x80 : inChar,
+           (blinkState ? ATTR_BLINK : 0) | (inverseState ? ATTR_INVERSE : 0) );
+  curX++;
+  if (curX >= 30) {
+    curX = 0;
+    curY++;
+  }
+  if (curY >= screenLines)
+    curY = 0;
+}
+
+/*******************************************************************************
+   Function: printNumber
+           : prints an unsigned integer at the cursor position
+ *******************************************************************************/
+void printNumber( unsigned int number )
+{
+  char buffer[6];
+  char *digit = utoa( number, buffer, 10 );
+
+  while (*digit)
+    printChar( *digit++ );
+}
+
+/*******************************************************************************
+   Function: drawBattery
+           : draws the battery symbol and optionally the battery percentage
+           : value = 0 to 100
+ *******************************************************************************/
+void drawBattery( byte xPos, byte yPos, byte value, bool showNumbers )
+{
+  curX = xPos;
+  curY = yPos;
+  if (value > 87)
+    printChar(OSD_BATTERY_100);
+  else if (value > 62)
+    printChar(OSD_BATTERY_75);
+  else if (value > 37)
+    printChar(OSD_BATTERY_50);
+  else if (value > 12)
+    printChar(OSD_BATTERY_25);
+  else
+    printChar(OSD_BATTERY_0);
+
+  if (showNumbers) {
+    printNumber(value);
+    printChar('%');
+  }
+}
+
+/*******************************************************************************
+   Function: drawInfoLine
+           : formats and draws the info line from an info line packet
+           : the packet holds channel, frequency, rssi, battery and flags
+ *******************************************************************************/
+void drawInfoLine( const byte *packet )
+{
+  byte channel = packet[INFO_CHANNEL];
+  byte flags = packet[INFO_FLAGS];
+  bool batteryText = flags & INFO_FLAG_BAT_TEXT;
+  byte textX;
+  byte batteryX;
+
+  if (flags & INFO_FLAG_LEFT) {
+    batteryX = INFO_LINE_LEFT_X;
+    textX = batteryX + BATTERY_SYMBOL_X_OFFSET_LEFT;
+    if (batteryText)
+      textX += BATTERY_TEXT_WIDTH;
+  }
+  else {
+    batteryX = BATTERY_RIGHT_X;
+    textX = INFO_LINE_RIGHT_X;
+    if (batteryText) {
+      batteryX -= BATTERY_TEXT_WIDTH;
+      textX -= BATTERY_TEXT_WIDTH;
+    }
+  }
+  drawBattery( batteryX, 0, packet[INFO_BATTERY], batteryText );
+
+  // Channel name, e.g. "c1" for raceband channel 1
+  curX = textX;
+  curY = 0;
+  printChar( (channel < 48) ? "abefcl"[channel / 8] : '?' );
+  printChar( (channel % 8) + '1' );
+  printChar( OSD_SPACE );
+  printChar( OSD_MHZ );
+  printNumber( (packet[INFO_FREQUENCY_HI] << 7) | packet[INFO_FREQUENCY_LO] );
+  printChar( OSD_SPACE );
+  printChar( OSD_ANTENNA );
+  printNumber( (packet[INFO_RSSI_HI] << 7) | packet[INFO_RSSI_LO] );
+}
+
+/*******************************************************************************
+   Function: dumpScreen
+           : prints the back buffer as text on the TX line, one row per
+           : visible line, followed by the max7456 SPI counters. Used to
+           : check screens without goggles. Letters and digits are printed
+           : as they are, filled characters without fill, other symbols as #.
+           : Status frames start with 255, which never occurs in the dump.
+ *******************************************************************************/
+void dumpScreen( void )
+{
+  unsigned int address = 0;
+  byte line, column, c;
+
+  for (line = 0; line < screenLines; line++) {
+    uart.write( '|' );
+    for (column = 0; column < SCREEN_COLUMNS; column++) {
+      c = screenChars[address++];
+      if ((c >= 0xA0) && (c < 0xFF))
+        c -= 0x80;
+      uart.write( (c == 0) ? ' ' : ((c >= 0x20) && (c < 0x7F)) ? c : '#' );
+    }
+    uart.write( '|' );
+    uart.println();
+  }
+  uart.print(F("spi: "));
+  uart.print(osd.getSpiTransactions());
+  uart.print(F(" transactions, "));
+  uart.print(osd.getSpiBytes());
+  uart.print(F(" bytes, "));
+  uart.print(osd.getBusTime());
+  uart.println(F(" us"));
+}
+
+/*******************************************************************************
+   Function: readTemplateHash
+           : returns the CRC of the templates stored in EEPROM
+ *******************************************************************************/
+unsigned int readTemplateHash( void )
+{
+  return EEPROM.read(EEPROM_TEMPLATE_HASH) | (EEPROM.read(EEPROM_TEMPLATE_HASH + 1) << 8);
+}
+
+/*******************************************************************************
+   Function: writeTemplateHash
+ *******************************************************************************/
+void writeTemplateHash( unsigned int hash )
+{
+  EEPROM.update(EEPROM_TEMPLATE_HASH, hash & 0xFF);
+  EEPROM.update(EEPROM_TEMPLATE_HASH + 1, hash >> 8);
+}
+
+/*******************************************************************************
+   Function: readTemplateOffset
+           : returns offset number i of the template image offset table
+ *******************************************************************************/
+unsigned int readTemplateOffset( byte i )
+{
+  unsigned int address = EEPROM_TEMPLATES + 1 + 2 * i;
+  return EEPROM.read(address) | (EEPROM.read(address + 1) << 8);
+}
+
+/*******************************************************************************
+   Function: beginTemplateUpload
+           : prepares for a new template image. The EEPROM is left untouched
+           : if the image is already stored.
+ *******************************************************************************/
+void beginTemplateUpload( const byte *params )
+{
+  unsigned int length = (params[3] << 7) | params[4];
+
+  templateUploadHash = ((unsigned int)params[0] << 14) | (params[1] << 7) | params[2];
+  templateUploadCrc = 0xFFFF;
+  templateUploadOffset = 0;
+  templateUploadSkip = (templateUploadHash == readTemplateHash()) ||
+                       (length > EEPROM_SIZE - EEPROM_TEMPLATES);
+  if (!templateUploadSkip)
+    writeTemplateHash( TEMPLATE_HASH_NONE );
+}
+
+/*******************************************************************************
+   Function: templateUploadByte
+           : stores a template image byte in EEPROM
+ *******************************************************************************/
+void templateUploadByte( byte data )
+{
+  if (templateUploadSkip)
+    return;
+  templateUploadCrc = _crc_ccitt_update(templateUploadCrc, data);
+  EEPROM.update(EEPROM_TEMPLATES + templateUploadOffset++, data);
+}
+
+/*******************************************************************************
+   Function: endTemplateUpload
+           : the templates are only valid if the CRC of the image is correct
+ *******************************************************************************/
+void endTemplateUpload( void )
+{
+  if (!templateUploadSkip && (templateUploadCrc == templateUploadHash))
+    writeTemplateHash( templateUploadHash );
+}
+
+/*******************************************************************************
+   Function: drawTemplate
+           : draws a template from EEPROM with its origin at x, y
+ *******************************************************************************/
+void drawTemplate( byte id, byte x, byte y )
+{
+  static bool drawing = false;
+  ParserState templateState = { PARSE_TEXT, 0, 0, {0}, 0 };
+  unsigned int address;
+  unsigned int end;
+
+  // Templates may not draw other templates
+  if (drawing || (readTemplateHash() == TEMPLATE_HASH_NONE))
+    return;
+  if (id >= EEPROM.read(EEPROM_TEMPLATES))
+    return;
+
+  drawing = true;
+  originX = x;
+  originY = y;
+  curX = x;
+  curY = y;
+  address = EEPROM_TEMPLATES + readTemplateOffset(id);
+  end = EEPROM_TEMPLATES + readTemplateOffset(id + 1);
+  for ( ; address < end; address++)
+    parseByte( templateState, EEPROM.read(address) );
+  originX = 0;
+  originY = 0;
+  drawing = false;
+}
+
+/*******************************************************************************
+   Function: paramsOfCommand
+           : returns the number of params that follow a command
+ *******************************************************************************/
+byte paramsOfCommand( byte command )
+{
+  return (command <= MAX_COMMAND) ? pgm_read_byte_near(commandParams + command) : 0;
+}
+
+/*******************************************************************************
+   Function: executeCommand
+           : executes a command once all of its params have been received
+ *******************************************************************************/
+void executeCommand( ParserState &state, byte command, const byte *params )
+{
+  switch (command) {
+    case CMD_LOAD_CHARS:        loadCharSet(); break;
+    case CMD_CLEAR_SCREEN:      clearBackBuffer(); break;
+    case CMD_ENABLE_OSD:        setOsdState( true ); break;
+    case CMD_DISABLE_OSD:       setOsdState(false); break;
+    case CMD_ENABLE_VIDEO:      setInVideoState( true ); break;
+    case CMD_DISABLE_VIDEO:     setInVideoState( false ); break;
+    case CMD_ENABLE_BLINK:      setBlinkState( true ); break;
+    case CMD_DISABLE_BLINK:     setBlinkState( false ); break;
+    case CMD_ENABLE_INVERSE:    setInverseState( true ); break;
+    case CMD_DISABLE_INVERSE:   setInverseState( false ); break;
+    case CMD_ENABLE_FILL:       setFillState( true ); break;
+    case CMD_DISABLE_FILL:      setFillState( false ); break;
+    case CMD_NEWLINE:           newLine(); break;
+    case CMD_SET_X:             curX = originX + params[0]; break;
+    case CMD_SET_Y:             curY = originY + params[0]; break;
+    case CMD_INFO_LINE:         drawInfoLine( params ); break;
+    case CMD_DRAW_TEMPLATE:     drawTemplate( params[0], params[1], params[2] ); break;
+    case CMD_LOAD_TEMPLATES:
+      beginTemplateUpload( params );
+      state.rawRemaining = (params[3] << 7) | params[4];
+      if (!state.rawRemaining)
+        endTemplateUpload();
+      break;
+    case CMD_SET_LOS_MODE:      setLosMode( params[0] ); break;
+    case CMD_DUMP_SCREEN:       dumpScreen(); break;
+    case CMD_SEND_COUNTERS:     sendCounters(); break;
+    case CMD_SURVEY_DATA:       state.rawRemaining = (params[0] << 7) | params[1]; break;
+    default: break;           // Unknown command - Just skip it
+  }
+}
+
+/*******************************************************************************
+   Function: runCommand
+           : executes the command of a parser once all params are received.
+           : The command may ask for raw data that follows the params.
+ *******************************************************************************/
+void runCommand( ParserState &state )
+{
+  state.rawRemaining = 0;
+  executeCommand( state, state.command, state.params );
+  state.mode = state.rawRemaining ? PARSE_RAW : PARSE_TEXT;
+}
+
+/*******************************************************************************
+   Function: parseByte
+           : feeds one byte of the display protocol to a parser
+ *******************************************************************************/
+void parseByte( ParserState &state, byte inChar )
+{
+  switch (pgm_read_byte_near(&parserActions[state.mode][inChar == CMD_CMD])) {
+    case ACTION_PRINT:
+      printChar( inChar );
+      break;
+    case ACTION_ESCAPE:
+      state.mode = PARSE_COMMAND;
+      break;
+    case ACTION_COMMAND:
+      state.command = inChar;
+      state.paramCount = 0;
+      state.mode = PARSE_PARAMS;
+      if (paramsOfCommand( inChar ) == 0)
+        runCommand( state );
+      break;
+    case ACTION_PARAM:
+      state.params[state.paramCount++] = inChar;
+      if (state.paramCount >= paramsOfCommand( state.command ))
+        runCommand( state );
+      break;
+    case ACTION_RAW:                  // Survey data is skipped
+      if (state.command == CMD_LOAD_TEMPLATES)
+        templateUploadByte( inChar );
+      if (--state.rawRemaining == 0) {
+        if (state.command == CMD_LOAD_TEMPLATES)
+          endTemplateUpload();
+        state.mode = PARSE_TEXT;
+      }
+      break;
+  }
+}
+
+/*******************************************************************************
+   Function: charSetHash
+           : returns the CRC of the compressed font in font.h
+ *******************************************************************************/
+unsigned int charSetHash( void )
+{
+  unsigned int crc = 0xFFFF;
+  unsigned int i;
+
+  for (i = 0; i < sizeof(fontRows); i++)
+    crc = _crc_ccitt_update(crc, pgm_read_byte_near(fontRows + i));
+  for (i = 0; i < sizeof(fontData); i++)
+    crc = _crc_ccitt_update(crc, pgm_read_byte_near(fontData + i));
+  return crc;
+}
+
+/*******************************************************************************
+   Function: writeCharSetHash
+ *******************************************************************************/
+void writeCharSetHash( unsigned int hash )
+{
+  EEPROM.update(EEPROM_CHARSET_HASH, hash & 0xFF);
+  EEPROM.update(EEPROM_CHARSET_HASH + 1, hash >> 8);
+}
+
 /*******************************************************************************
    Function: loadCharSet
-           : Loads the characters of the variable tableOfAllCharacters
+           : Loads the characters of the compressed font in font.h
            : into the EEPROM character memory of the max7456 circuit
  *******************************************************************************/
 void loadCharSet( void )
 {
   charact currentChar;
+  const byte *data = fontData;
   bool initialOsdState = osdState;  // save OSD display state
   setOsdState( false );             // Deactivate osd display.
   for (int i = 0 ; i <= 0xff; i++)
   {
-    Max7456::getCARACFromProgMem(tableOfAllCharacters, i, currentChar);
-    osd.sendCharacter(currentChar, i);
+    data = Max7456::decodeCharacter(fontRows, data, currentChar);
+    osd.startSendCharacter(currentChar, i);
+    while (!osd.poll())
+      updateStatus();
+    updateStatus();                 // Keep CYCLOP++ informed during long loads
   }
+  writeCharSetHash( charSetHash() );
   setOsdState( initialOsdState );  // restore original OSD display state
 }
 
+/*******************************************************************************
+   Function: updateCharSet
+           : Brings the max7456 character memory up to date with the
+           : compressed font in font.h. Nothing is done if the font table has not
+           : changed since the last load. Otherwise each character is read back
+           : and only rewritten if it differs, to save boot time and NVM write
+           : cycles.
+           : returns the number of characters written
+ *******************************************************************************/
+unsigned int updateCharSet( void )
+{
+  charact currentChar;
+  charact storedChar;
+  const byte *data = fontData;
+  unsigned int hash = charSetHash();
+  unsigned int storedHash = EEPROM.read(EEPROM_CHARSET_HASH) | (EEPROM.read(EEPROM_CHARSET_HASH + 1) << 8);
+  bool initialOsdState = osdState;
+  unsigned int written = 0;
+  byte i = 0;
+
+  // An erased EEPROM (0xFFFF) never counts as a loaded font
+  if ((hash == storedHash) && (storedHash != 0xFFFF))
+    return 0;
+
+  setOsdState( false );
+  do {
+    data = Max7456::decodeCharacter(fontRows, data, currentChar);
+    osd.getCharacter(storedChar, i, 0);
+    if (memcmp(storedChar, currentChar, sizeof(charact))) {
+      osd.startSendCharacter(currentChar, i);
+      while (!osd.poll())
+        updateStatus();
+      written++;
+    }
+    updateStatus();
+  } while (++i);
+  writeCharSetHash( hash );
+  setOsdState( initialOsdState );
+  return written;
+}
+
 /*******************************************************************************
    Function: setup
              The Arduino setup function. Automatically runs once before loop
@@ -1950,16 +1151,35 @@ void loadCharSet( void )
 void setup()
 {
   byte tab[] = {0xC8, 0xC9};
+#ifdef BOOT_REPORT
+  unsigned long bootTime;
+  unsigned int written;
+  bool ready;
+#endif
   // SPI Setup
   pinMode(CS_PIN, OUTPUT);
   pinMode(SS, OUTPUT);
   SPI.begin();
 
-  // Serial channel setup
-  Serial.begin(57600);
+  // Serial channel setup. A new epoch tells CYCLOP++ that the status
+  // counters start over.
+  bootEpoch = (EEPROM.read(EEPROM_BOOT_EPOCH) + 1) & 0x7F;
+  EEPROM.update(EEPROM_BOOT_EPOCH, bootEpoch);
+  uart.begin(57600);
 
   // MAX7456 setup
+#ifdef BOOT_REPORT
+  ready = osd.init(CS_PIN);
+  uart.print(F("max7456 init: "));
+  if (!ready)
+    uart.print(F("reset timed out, "));
+  uart.print(osd.getSpiBytes());
+  uart.print(F(" SPI bytes, "));
+  uart.print(osd.getBusTime());
+  uart.println(F(" us bus time"));
+#else
   osd.init(CS_PIN);
+#endif
   osd.setDisplayOffsets(44, 30);
   osd.setBlinkParams(_8fields, _BT_BT); // TODO - Why and What?
   setBlinkState( blinkState );
@@ -1967,8 +1187,23 @@ void setup()
   setInverseState( inverseState);
   setOsdState( osdState );
   setInVideoState(inVideoState);
-  loadCharSet();
+
+#ifdef BOOT_REPORT
+  bootTime = millis();
+  written = updateCharSet();
+  uart.print(F("charset: "));
+  uart.print(written);
+  uart.print(F(" chars written, "));
+  uart.print(millis() - bootTime);
+  uart.println(F(" ms"));
+#else
+  updateCharSet();
+#endif
   osd.clearScreen();
+
+  // Commit the back buffer at the start of each field
+  pinMode(VSYNC_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(VSYNC_PIN), vsyncInterrupt, FALLING);
 }
 
 /*******************************************************************************
@@ -1977,63 +1212,46 @@ void setup()
  *******************************************************************************/
 void loop()
 {
-  static bool activeCommand = false;
-  static bool waitingForX = false;
-  static bool waitingForY = false;
-  long videoUpdateTimer = 0;
-  unsigned char inChar;
-
-  // Process serial data
-  if (Serial.available()) {
-    inChar = Serial.read();
-    if ( inChar == CMD_CMD) {
-      activeCommand = true;
-    }
-    else {
-      if (activeCommand) {
-        switch (inChar) {
-          case CMD_LOAD_CHARS:        loadCharSet(); break;
-          case CMD_CLEAR_SCREEN:      osd.clearScreen(); break;
-          case CMD_ENABLE_OSD:        setOsdState( true ); break;
-          case CMD_DISABLE_OSD:       setOsdState(false); break;
-          case CMD_ENABLE_VIDEO:      setInVideoState( true ); break;
-          case CMD_DISABLE_VIDEO:     setInVideoState( false ); break;
-          case CMD_ENABLE_BLINK:      setBlinkState( true ); break;
-          case CMD_DISABLE_BLINK:     setBlinkState( false ); break;
-          case CMD_ENABLE_INVERSE:    setInverseState( true ); break;
-          case CMD_DISABLE_INVERSE:   setInverseState( false ); break;
-          case CMD_ENABLE_FILL:       setFillState( true ); break;
-          case CMD_DISABLE_FILL:      setFillState( false ); break;
-          case CMD_NEWLINE:           newLine(); break;
-          case CMD_SET_X:             waitingForX = true; break;
-          case CMD_SET_Y:             waitingForY = true; break;
-          default: break;           // Unknown command - Just skip it
-        }
-        activeCommand = false;
-      }
-      else if (waitingForX) {
-        curX = inChar;
-        waitingForX = false;
-      }
-      else if (waitingForY) {
-        curY = inChar;
-        waitingForY = false;
-      }
-      else {
-        osd.printMax7456Char( fillState && (inChar > 31) && (inChar < 128) ? inChar + 0x80 : inChar, curX++, curY, blinkState, inverseState );
-        if (curX >= 30) {
-          curX = 0;
-          curY++;
-        }
-        if (curY >= MAX_LINES)
-          curY = 0;
-      }
+  static ParserState serialState = { PARSE_TEXT, 0, 0, {0}, 0 };
+  static unsigned long videoUpdateTimer = 0;
+  static unsigned long fieldTimer = 0;
+#ifdef BOOT_REPORT
+  static bool firstCharacterShown = false;
+#endif
+
+  // Process all received serial data and report consumed bytes to CYCLOP++.
+  // Drawing only updates the back buffer. A new field is handled first.
+  while (uart.available() && !fieldStart) {
+    parseByte( serialState, uart.read() );
+    updateStatus();
+  }
+  updateStatus();
+
+  // Write changes to the max7456 at the start of a field. Without ~VSYNC
+  // interrupts the changes are written after FIELD_TIMEOUT_MS. After a
+  // display memory clear they are written as soon as the clear is done.
+  if ((fieldStart || screenClearing || (millis() - fieldTimer >= FIELD_TIMEOUT_MS)) && osd.poll())
+  {
+    fieldStart = false;
+    fieldTimer = millis();
+    updateLossOfSync();
+    commitScreen();
+
+#ifdef BOOT_REPORT
+    // Report the boot time once the first characters are on screen
+    if (cellsPerField && !firstCharacterShown) {
+      firstCharacterShown = true;
+      uart.print(F("first character: "));
+      uart.print(millis());
+      uart.println(F(" ms"));
     }
+#endif
   }
+
   // Check if it is time to update the video format
-  if (videoUpdateTimer < millis())
+  if (millis() - videoUpdateTimer >= VIDEO_INTERVAL_MS)
   {
-    videoUpdateTimer = millis() + 500;
+    videoUpdateTimer = millis();
     updateVideoFormat();
   }
 }
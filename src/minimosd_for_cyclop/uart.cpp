@@ -0,0 +1,169 @@
+/*****************************************************************************
+   File: uart.cpp
+
+   Author: Kjell Kernen
+
+   Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "uart.h"
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#define RX_MASK (UART_RX_BUFFER_SIZE - 1)
+#define TX_MASK (UART_TX_BUFFER_SIZE - 1)
+
+Uart uart;
+
+/******************************************************************************
+   Buffers and counters shared with the interrupt handlers
+ ******************************************************************************/
+static volatile byte rxBuffer[UART_RX_BUFFER_SIZE];
+static volatile byte rxHead = 0;
+static volatile byte rxTail = 0;
+static volatile byte txBuffer[UART_TX_BUFFER_SIZE];
+static volatile byte txHead = 0;
+static volatile byte txTail = 0;
+static volatile unsigned int rxOverflows = 0;
+static unsigned long rxReadCount = 0;
+
+/******************************************************************************
+   Function: Uart::begin
+ ******************************************************************************/
+void Uart::begin(unsigned long baud)
+{
+  unsigned int ubrr = (F_CPU / 4 / baud - 1) / 2;
+
+  UCSR0A = _BV(U2X0);                               // Double speed
+  UBRR0H = ubrr >> 8;
+  UBRR0L = ubrr;
+  UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);               // 8N1
+  UCSR0B = _BV(RXEN0) | _BV(TXEN0) | _BV(RXCIE0);
+}
+
+/******************************************************************************
+   Function: Uart::available
+ ******************************************************************************/
+byte Uart::available(void)
+{
+  return (rxHead - rxTail) & RX_MASK;
+}
+
+/******************************************************************************
+   Function: Uart::read
+ ******************************************************************************/
+int Uart::read(void)
+{
+  byte data;
+
+  if (rxHead == rxTail)
+    return -1;
+  data = rxBuffer[rxTail];
+  rxTail = (rxTail + 1) & RX_MASK;
+  rxReadCount++;
+  return data;
+}
+
+/******************************************************************************
+   Function: Uart::availableForWrite
+ ******************************************************************************/
+byte Uart::availableForWrite(void)
+{
+  return (txTail - txHead - 1) & TX_MASK;
+}
+
+/******************************************************************************
+   Function: Uart::write
+ ******************************************************************************/
+size_t Uart::write(uint8_t data)
+{
+  byte next = (txHead + 1) & TX_MASK;
+
+  while (next == txTail) ;
+  txBuffer[txHead] = data;
+  txHead = next;
+  UCSR0B |= _BV(UDRIE0);
+  return 1;
+}
+
+/******************************************************************************
+   Function: Uart::readCount
+ ******************************************************************************/
+unsigned long Uart::readCount(void)
+{
+  return rxReadCount;
+}
+
+/******************************************************************************
+   Function: Uart::overflows
+ ******************************************************************************/
+unsigned int Uart::overflows(void)
+{
+  unsigned int count;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    count = rxOverflows;
+  }
+  return count;
+}
+
+/******************************************************************************
+   Function: Uart::rxInterrupt
+             A byte has been received. Count it as lost if the hardware
+             reports an overrun or if there is no room in the buffer.
+ ******************************************************************************/
+void Uart::rxInterrupt(void)
+{
+  byte status = UCSR0A;
+  byte data = UDR0;
+  byte next = (rxHead + 1) & RX_MASK;
+
+  if (status & _BV(DOR0))
+    rxOverflows++;
+  if (next == rxTail)
+    rxOverflows++;
+  else {
+    rxBuffer[rxHead] = data;
+    rxHead = next;
+  }
+}
+
+/******************************************************************************
+   Function: Uart::txInterrupt
+             The transmit data register is empty. Send the next byte.
+ ******************************************************************************/
+void Uart::txInterrupt(void)
+{
+  if (txHead == txTail)
+    UCSR0B &= ~_BV(UDRIE0);
+  else {
+    UDR0 = txBuffer[txTail];
+    txTail = (txTail + 1) & TX_MASK;
+  }
+}
+
+ISR(USART_RX_vect)
+{
+  Uart::rxInterrupt();
+}
+
+ISR(USART_UDRE_vect)
+{
+  Uart::txInterrupt();
+}
@@ -0,0 +1,76 @@
+/*****************************************************************************
+   File: uart.h
+
+   Author: Kjell Kernen
+
+   Interrupt driven serial port with overflow detection. Replaces the Arduino
+   Serial object, which silently drops bytes when its receive buffer is full.
+
+   Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef UART_H
+#define UART_H
+
+#include <Arduino.h>
+
+/* Buffer sizes must be powers of two */
+#define UART_RX_BUFFER_SIZE 128
+#define UART_TX_BUFFER_SIZE 32
+
+/*  class Uart - Represents the hardware serial port of the Atmega 328 */
+
+class Uart : public Print
+{
+  public:
+    /* Start the serial port
+       baud : the baud rate */
+    void begin(unsigned long baud);
+
+    /* Number of received bytes waiting in the receive buffer */
+    byte available(void);
+
+    /* Read one byte from the receive buffer
+       return : the byte, or -1 if the buffer is empty */
+    int read(void);
+
+    /* Number of bytes that can be written without blocking */
+    byte availableForWrite(void);
+
+    /* Write one byte. Blocks if the transmit buffer is full */
+    virtual size_t write(uint8_t data);
+    using Print::write;
+
+    /* Number of bytes read from the receive buffer since start.
+       Used by the sender to calculate free buffer space. */
+    unsigned long readCount(void);
+
+    /* Number of received bytes lost since start, either because the
+       receive buffer was full or because of a hardware overrun. */
+    unsigned int overflows(void);
+
+    /* Interrupt handlers, not to be called directly */
+    static void rxInterrupt(void);
+    static void txInterrupt(void);
+};
+
+extern Uart uart;
+
+#endif /* UART_H */
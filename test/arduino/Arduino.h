@@ -0,0 +1,110 @@
+/*****************************************************************************
+   File: Arduino.h
+
+   Author: Kjell Kernen
+
+   Host replacement of the Arduino core for the host build in the test folder.
+   Only the parts used by CYCLOP++ and the MinimOSD are declared. Time, pins,
+   the ADC, serial ports, EEPROM and SPI are modelled in host/hal.cpp.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <avr/pgmspace.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+#define HIGH          0x1
+#define LOW           0x0
+
+#define INPUT         0x0
+#define OUTPUT        0x1
+#define INPUT_PULLUP  0x2
+
+#define CHANGE        1
+#define FALLING       2
+#define RISING        3
+
+#define LSBFIRST      0
+#define MSBFIRST      1
+
+#define DEC           10
+#define HEX           16
+
+/* Pin numbers of an Arduino Pro Mini */
+#define A0            14
+#define A1            15
+#define A2            16
+#define A3            17
+#define A4            18
+#define A5            19
+#define A6            20
+#define A7            21
+#define SS            10
+#define MOSI          11
+#define MISO          12
+#define SCK           13
+#define NUM_PINS      22
+
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : -1))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+uint8_t digitalPinToPort(uint8_t pin);
+uint8_t digitalPinToBitMask(uint8_t pin);
+volatile uint8_t *portOutputRegister(uint8_t port);
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode);
+void detachInterrupt(uint8_t interruptNum);
+
+/* avr-libc number conversions */
+char *itoa(int value, char *string, int radix);
+char *utoa(unsigned int value, char *string, int radix);
+char *ltoa(long value, char *string, int radix);
+char *ultoa(unsigned long value, char *string, int radix);
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+#include "WString.h"
+#include "Print.h"
+#include "HardwareSerial.h"
+
+#endif /* ARDUINO_H */
@@ -0,0 +1,39 @@
+/*****************************************************************************
+   File: interrupt.h
+
+   Author: Kjell Kernen
+
+   Interrupts of the host build. Handlers are called by host/hal.cpp between
+   calls into the Arduino core, never in the middle of firmware code.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+void halDisableInterrupts(void);
+void halEnableInterrupts(void);
+
+#define ISR(vector, ...)  extern "C" void vector(void); extern "C" void vector(void)
+#define cli()             halDisableInterrupts()
+#define sei()             halEnableInterrupts()
+
+#endif /* INTERRUPT_H */
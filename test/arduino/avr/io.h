@@ -0,0 +1,81 @@
+/*****************************************************************************
+   File: io.h
+
+   Author: Kjell Kernen
+
+   Registers of the host build. Only the USART 0 registers used by the
+   MinimOSD uart and the port output registers exist. UDR0 and UCSR0B are
+   objects, so that the host model sees reads and writes of them.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef IO_H
+#define IO_H
+
+#include <stdint.h>
+
+/* UCSR0A */
+#define RXC0    7
+#define TXC0    6
+#define UDRE0   5
+#define FE0     4
+#define DOR0    3
+#define U2X0    1
+/* UCSR0B */
+#define RXCIE0  7
+#define TXCIE0  6
+#define UDRIE0  5
+#define RXEN0   4
+#define TXEN0   3
+/* UCSR0C */
+#define UCSZ01  2
+#define UCSZ00  1
+
+#define _BV(bit) (1 << (bit))
+
+class HalUdr
+{
+  public:
+    operator uint8_t() const;             // Reads the received byte
+    HalUdr &operator=(uint8_t data);      // Sends a byte
+};
+
+class HalUcsr0b
+{
+  public:
+    operator uint8_t() const { return value; }
+    HalUcsr0b &operator=(uint8_t data);   // Runs the UDRE handler if enabled
+    HalUcsr0b &operator|=(uint8_t data) { return *this = value | data; }
+    HalUcsr0b &operator&=(uint8_t data) { return *this = value & data; }
+    uint8_t value;
+};
+
+extern HalUdr UDR0;
+extern HalUcsr0b UCSR0B;
+extern volatile uint8_t UCSR0A;
+extern volatile uint8_t UCSR0C;
+extern volatile uint8_t UBRR0H;
+extern volatile uint8_t UBRR0L;
+extern volatile uint8_t PORTB;
+extern volatile uint8_t PORTC;
+extern volatile uint8_t PORTD;
+
+#endif /* IO_H */
@@ -0,0 +1,48 @@
+/*****************************************************************************
+   File: pgmspace.h
+
+   Author: Kjell Kernen
+
+   Program memory access of the host build. Flash and RAM share one address
+   space on the host, so PROGMEM data is read directly. pgm_read_word reads
+   through the typed pointer, since pointers in flash tables are wider than
+   a word on the host.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef PGMSPACE_H
+#define PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P                       const char *
+#define PSTR(s)                     (s)
+#define pgm_read_byte_near(address) (*(const uint8_t *)(address))
+#define pgm_read_byte(address)      pgm_read_byte_near(address)
+#define pgm_read_word_near(address) (*(address))
+#define pgm_read_word(address)      pgm_read_word_near(address)
+#define strlen_P                    strlen
+#define strcpy_P                    strcpy
+#define memcpy_P                    memcpy
+
+#endif /* PGMSPACE_H */
@@ -0,0 +1,50 @@
+/*****************************************************************************
+   File: atomic.h
+
+   Author: Kjell Kernen
+
+   Atomic blocks of the host build. Interrupts are held back by host/hal.cpp
+   until the block is left, also when it is left with return.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#include <stdint.h>
+#include <avr/interrupt.h>
+
+static inline uint8_t halAtomicEnter(void)
+{
+  halDisableInterrupts();
+  return 1;
+}
+
+static inline void halAtomicLeave(const uint8_t *state)
+{
+  halEnableInterrupts();
+}
+
+#define ATOMIC_RESTORESTATE uint8_t _atomicState __attribute__((__cleanup__(halAtomicLeave))) = 0
+#define ATOMIC_FORCEON      ATOMIC_RESTORESTATE
+#define ATOMIC_BLOCK(type)  for (type, _atomicToDo = halAtomicEnter(); _atomicToDo; _atomicToDo = 0)
+
+#endif /* ATOMIC_H */
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+  File: avr_size.py
+
+  Author: Kjell Kernen
+
+  Builds both sketches for their boards at a git revision and in the working
+  tree and prints the flash and RAM use of each, so the size effect of a
+  change can be compared. Flash is text + data and RAM is data + bss, as
+  reported by avr-size. Needs arduino-cli with the arduino:avr core and the
+  EnableInterrupt library installed. The host build in this folder does not
+  say anything about the sizes on the Atmega 328.
+
+  Usage: avr_size.py [base revision, default HEAD]
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+"""
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Sketch folder under src and the board it is built for, see BUILDING.md
+SKETCHES = [("cyclop_plus_plus", "arduino:avr:pro:cpu=8MHzatmega328"),
+            ("minimosd_for_cyclop", "arduino:avr:pro:cpu=16MHzatmega328")]
+
+
+def find_avr_size():
+    path = shutil.which("avr-size")
+    if path:
+        return path
+    found = sorted(glob.glob(os.path.expanduser(
+        "~/.arduino15/packages/arduino/tools/avr-gcc/*/bin/avr-size")))
+    return found[-1] if found else None
+
+
+def sketch_size(root, sketch, fqbn, avr_size, build):
+    """Returns (flash, ram) in bytes of a sketch in a source tree"""
+    output = os.path.join(build, sketch)
+    subprocess.run(["arduino-cli", "compile", "--fqbn", fqbn, "--output-dir", output,
+                    os.path.join(root, "src", sketch)], check=True, stdout=subprocess.DEVNULL)
+    lines = subprocess.run([avr_size, "--format=berkeley", os.path.join(output, sketch + ".ino.elf")],
+                           check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout.splitlines()
+    text, data, bss = (int(v) for v in lines[1].split()[:3])
+    return text + data, data + bss
+
+
+def main():
+    base = sys.argv[1] if len(sys.argv) > 1 else "HEAD"
+    root = subprocess.run(["git", "rev-parse", "--show-toplevel"], check=True, stdout=subprocess.PIPE,
+                          universal_newlines=True).stdout.strip()
+    avr_size = find_avr_size()
+    if not shutil.which("arduino-cli") or not avr_size:
+        sys.exit("avr_size.py needs arduino-cli and avr-size, see BUILDING.md")
+
+    build = tempfile.mkdtemp()
+    tree = os.path.join(build, "base")
+    try:
+        subprocess.run(["git", "-C", root, "worktree", "add", "--detach", tree, base], check=True,
+                       stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        print("%-20s %10s %10s %10s %10s" % ("sketch", "flash " + base[:4], "flash now", "ram " + base[:4], "ram now"))
+        for sketch, fqbn in SKETCHES:
+            before = sketch_size(tree, sketch, fqbn, avr_size, os.path.join(build, "before"))
+            after = sketch_size(root, sketch, fqbn, avr_size, os.path.join(build, "after"))
+            print("%-20s %10d %10d %10d %10d" % (sketch, before[0], after[0], before[1], after[1]))
+    finally:
+        subprocess.run(["git", "-C", root, "worktree", "remove", "--force", tree], stderr=subprocess.DEVNULL)
+        shutil.rmtree(build, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,960 @@
+/*****************************************************************************
+   File: cyclop_host.cpp
+
+   Author: Kjell Kernen
+
+   Host build of CYCLOP++. The sketch is compiled as it is against the
+   Arduino shim, followed by its unit tests.
+   Usage: cyclop_host test [name prefix]
+          cyclop_host record <screen> <file>
+          cyclop_host scan [scene]
+          cyclop_host bench <result file>
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include <Arduino.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "host/hal.h"
+#include "host/check.h"
+#include "host/rx5808.h"
+#include "host/rfscene.h"
+
+#include "../src/cyclop_plus_plus/cyclop_plus_plus.ino"
+
+/******************************************************************************
+   Helpers
+ ******************************************************************************/
+/* Bytes sent on Serial since the given output position */
+static std::vector<uint8_t> serialSince(size_t start)
+{
+  std::vector<uint8_t> bytes;
+  const std::vector<HalByte> &output = halSerialOutput();
+
+  for (size_t i = start; i < output.size(); i++)
+    bytes.push_back(output[i].data);
+  return bytes;
+}
+
+/* Queues a status frame from the MinimOSD */
+static void receiveStatus(uint64_t time, unsigned int consumed, unsigned int overflows, unsigned int hash,
+                          unsigned char epoch = 1)
+{
+  unsigned char frame[STATUS_PARAMS + 1] = {
+    STATUS_FRAME, (unsigned char)((consumed >> 7) & 0x7F), (unsigned char)(consumed & 0x7F),
+    128 / 8 - 1, VIDEO_PAL, (unsigned char)((overflows >> 7) & 0x7F), (unsigned char)(overflows & 0x7F),
+    (unsigned char)(hash >> 14), (unsigned char)((hash >> 7) & 0x7F), (unsigned char)(hash & 0x7F), epoch, 0
+  };
+
+  for (int i = 0; i < STATUS_PARAMS; i++)
+    frame[STATUS_PARAMS] ^= frame[i];
+  halSerialReceive(time, STATUS_START);
+  for (int i = 0; i < STATUS_PARAMS + 1; i++)
+    halSerialReceive(time, frame[i]);
+}
+
+/* A MinimOSD that consumes all bytes at once and reports fakeOsdHash as its
+   template CRC in a status frame every 5 ms */
+static unsigned int fakeOsdHash;
+
+static void fakeMinimOsd(void)
+{
+  receiveStatus(halNow(), osdSent, 0, fakeOsdHash);
+  halAt(halNow() + 5 * HAL_NS_PER_MS, fakeMinimOsd);
+}
+
+static unsigned int storedTemplateHash(void)
+{
+  return halEeprom()[EEPROM_TEMPLATE_HASH] | (halEeprom()[EEPROM_TEMPLATE_HASH + 1] << 8);
+}
+
+/******************************************************************************
+   Receiver
+ ******************************************************************************/
+TEST(receiver_tune)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+
+  receiver.begin();
+  receiver.setFrequency(5865);
+  CHECK_EQUAL(5865, rx.frequency());
+  CHECK_EQUAL(5865, receiver.getFrequency());
+  receiver.setFrequency(5800);          // The synthesizer has 2 MHz steps
+  CHECK_EQUAL(5799, rx.frequency());
+  receiver.setFrequency(5645);
+  CHECK_EQUAL(5645, rx.frequency());
+  CHECK_EQUAL(3, rx.tunes());
+  CHECK_EQUAL(3, receiver.getTuneCount());
+}
+
+TEST(receiver_same_frequency)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+
+  receiver.begin();
+  receiver.setFrequency(5740);
+  receiver.setFrequency(5740);
+  CHECK_EQUAL(1, rx.tunes());
+  CHECK_EQUAL(1, receiver.getTuneCount());
+}
+
+/******************************************************************************
+   Channels
+ ******************************************************************************/
+TEST(channel_best_match)
+{
+  unsigned char channel;
+
+  resetOptions();
+  for (channel = CHANNEL_MIN; channel <= CHANNEL_MAX; channel++)
+    CHECK_EQUAL(getFrequency(channel), getFrequency(bestChannelMatch(getFrequency(channel))));
+  CHECK_EQUAL(5945, getFrequency(bestChannelMatch(6000)));
+  CHECK_EQUAL(5362, getFrequency(bestChannelMatch(5300)));
+}
+
+/******************************************************************************
+   Scanner
+ ******************************************************************************/
+TEST(scanner_history)
+{
+  setHistoryLevel(0, 7, 20);
+  setHistoryLevel(1, 7, 4);
+  setHistoryLevel(1, 8, 9);
+  CHECK_EQUAL(15, historyLevel(0, 7));
+  CHECK_EQUAL(4, historyLevel(1, 7));
+  CHECK_EQUAL(9, historyLevel(1, 8));
+  CHECK_EQUAL(15, peakLevel(7));
+  CHECK_EQUAL(9, peakLevel(8));
+  CHECK_EQUAL(0, peakLevel(9));
+  setHistoryLevel(0, 7, 0);
+  CHECK_EQUAL(4, peakLevel(7));
+  CHECK_EQUAL(9, historyLevel(1, 8));
+}
+
+TEST(scanner_hot_index)
+{
+  const unsigned char levels[8] = { 0, 5, 2, 1, 8, 8, 0, 2 };
+
+  CHECK_EQUAL(4, hotIndex(levels, 8, 1, true, 3));
+  CHECK_EQUAL(1, hotIndex(levels, 8, 4, true, 3));
+  CHECK_EQUAL(1, hotIndex(levels, 8, 4, false, 3));
+  CHECK_EQUAL(4, hotIndex(levels, 8, 1, false, 3));
+  CHECK_EQUAL(3, hotIndex(levels, 8, 2, true, 9));
+  CHECK_EQUAL(7, hotIndex(levels, 8, 0, false, 9));
+}
+
+TEST(scanner_bar_glyph)
+{
+  CHECK_EQUAL(OSD_BAR_1111, barGlyph(24, 24, 0));
+  CHECK_EQUAL(OSD_BAR_EMPTY, barGlyph(0, 0, 0));
+  CHECK_EQUAL(OSD_BAR_0011, barGlyph(1, 1, 0));
+  CHECK_EQUAL(OSD_BAR_1011, barGlyph(2, 1, 0));
+  CHECK_EQUAL(OSD_BAR_0001, barGlyph(0, 5, 2));
+  CHECK_EQUAL(' ', barGlyph(4, 4, 2));
+}
+
+TEST(scanner_cursor_row)
+{
+  size_t start;
+  std::vector<uint8_t> sent;
+
+  Serial.begin(57600);
+  drawScannerScreen();
+  drawScannerCursor(3, 5800);
+  drawScannerScreen();                    // A new scanner has no cursor to erase
+  start = halSerialOutput().size();
+  drawScannerCursor(5, 5800);
+  const uint8_t expected[] = { CMD_CMD, CMD_SET_X, 5, CMD_CMD, CMD_SET_Y,
+                               (uint8_t)(scannerBarLine - SCANNER_ROWS), 'v' };
+  sent = serialSince(start);
+  CHECK(std::vector<uint8_t>(sent.begin(), sent.begin() + sizeof(expected)) ==
+        std::vector<uint8_t>(expected, expected + sizeof(expected)));
+
+  // The bars stay below the cursor
+  start = halSerialOutput().size();
+  updateScannerScreen(5, 24, 24);
+  updateScannerScreen(6, 24, 24);
+  sent = serialSince(start);
+  for (size_t i = 0; i + 1 < sent.size(); i++)
+    if (sent[i] == CMD_SET_Y)
+      CHECK(sent[i + 1] > scannerBarLine - SCANNER_ROWS);
+}
+
+TEST(scanner_noise_segment)
+{
+  CHECK_EQUAL(0, noiseSegment(5300));
+  CHECK_EQUAL(0, noiseSegment(5444));
+  CHECK_EQUAL(1, noiseSegment(5445));
+  CHECK_EQUAL(4, noiseSegment(5800));
+  CHECK_EQUAL(NOISE_SEGMENTS - 1, noiseSegment(5945));
+}
+
+TEST(scanner_rssi_level)
+{
+  noiseFloor[noiseSegment(5800)] = 200;
+  rssiMax = 400;
+  CHECK_EQUAL(0, rssiLevel(5800, 150, 22));
+  CHECK_EQUAL(0, rssiLevel(5800, 200, 22));
+  CHECK_EQUAL(11, rssiLevel(5800, 300, 22));
+  CHECK_EQUAL(22, rssiLevel(5800, 500, 22));
+  rssiMax = 150;                            // Below the floor
+  CHECK_EQUAL(0, rssiLevel(5800, 300, 22));
+}
+
+/* Runs graphicScanner with a strong signal at 5800 MHz and the given button
+   presses, in ms after the start and held ms
+   return : the picked frequency */
+static unsigned int runScanner(const uint64_t press[][2], size_t count)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+  static RfScene *current;
+  uint64_t start = halNow();
+
+  current = &scene;
+  scene.setNoise(140, 0, 4);
+  scene.add({ 5800, 38, 18, 0 });
+  halSetAnalog(RSSI_PIN, []() { return current->rssi(); });
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  enableInterrupt(BUTTON_PIN, buttonPressInterrupt, CHANGE);
+  Serial.begin(OSD_BAUD_RATE);
+  resetOptions();
+  receiver.begin();
+  readCalibration();
+  for (size_t i = 0; i < count; i++)
+    halPress(BUTTON_PIN, start + press[i][0] * HAL_NS_PER_MS, press[i][1] * HAL_NS_PER_MS);
+  return graphicScanner(5645);
+}
+
+TEST(scanner_very_long_click_skips_zoom)
+{
+  const uint64_t press[][2] = { { 8000, 100 }, { 9000, 3500 } };
+  unsigned int frequency;
+
+  frequency = runScanner(press, 2);
+  CHECK(frequency >= 5790 && frequency <= 5810);
+  CHECK_EQUAL(0, (frequency - FREQUENCY_MIN) % SCANNING_STEP);  // Not zoomed
+  CHECK_EQUAL(frequency, receiver.getFrequency());
+}
+
+TEST(scanner_zoom_labels_clear_cursor)
+{
+  const uint64_t press[][2] = { { 8000, 100 }, { 9000, 500 }, { 12000, 100 }, { 13000, 500 } };
+  size_t start = halSerialOutput().size();
+  std::vector<uint8_t> sent;
+  unsigned int frequency;
+
+  frequency = runScanner(press, 4);
+  CHECK(frequency >= 5790 && frequency <= 5810);
+  CHECK_EQUAL(1, frequency & 1);                                // Zoomed
+  sent = serialSince(start);
+  // Only the cursor frequency is drawn in columns 10 - 16 of the label line
+  for (size_t i = 0; i + 4 < sent.size(); i++)
+    if ((sent[i] == CMD_SET_X) && (sent[i + 3] == CMD_SET_Y) && (sent[i + 4] == scannerBarLine + 1))
+      CHECK(sent[i + 1] <= 10 || sent[i + 1] > 16);
+}
+
+/******************************************************************************
+   Signal watchdog
+ ******************************************************************************/
+static Rx5808 *watchRx;
+static unsigned int watchMaxTuned;
+
+/* Calibrates a noise floor of 150 and a range of 150 - 450 and tunes to
+   5800 MHz with a learned RSSI of 400 */
+static void watchSetup(Rx5808 &rx)
+{
+  watchRx = &rx;
+  watchMaxTuned = 0;
+  resetOptions();
+  Serial.begin(OSD_BAUD_RATE);
+  for (int i = 0; i < NOISE_SEGMENTS; i++)
+    noiseFloor[i] = 150;
+  rssiMin = 150;
+  rssiMax = 450;
+  receiver.begin();
+  receiver.setFrequency(5800);
+  goodFrequency = 5800;
+  goodRssi = 400;
+  signalLostTime = 0;
+}
+
+/* One info line sample a second */
+static void watchSeconds(int seconds)
+{
+  for (int i = 0; i < seconds; i++) {
+    halAdvance(1000 * HAL_NS_PER_MS);
+    signalRssi = averageAnalogRead(RSSI_PIN);
+    watchSignal();
+  }
+}
+
+TEST(watch_weaker_signal_keeps_frequency)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  unsigned long tunes;
+
+  watchSetup(rx);
+  tunes = rx.tunes();
+  // Below halfway to the learned 400, but well above the noise floor
+  halSetAnalog(RSSI_PIN, []() { return 260; });
+  watchSeconds(60);
+  CHECK_EQUAL(tunes, rx.tunes());
+  CHECK_EQUAL(5800, receiver.getFrequency());
+  CHECK(goodRssi < 300);                    // Learned the weaker signal
+}
+
+TEST(watch_reacquire_shows_tuned_frequency)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  size_t start;
+  std::vector<uint8_t> sent;
+
+  watchSetup(rx);
+  // The transmitter has moved to 5795 MHz, between channels
+  halSetAnalog(RSSI_PIN, []() { return abs((int)watchRx->frequency() - 5795) <= 1 ? 400 : 150; });
+  watchSeconds(4);
+  CHECK_EQUAL(5795, receiver.getFrequency());
+  CHECK_EQUAL(bestChannelMatch(receiver.getFrequency()), currentChannel);
+
+  start = halSerialOutput().size();
+  drawInfoLine();
+  sent = serialSince(start);
+  CHECK_EQUAL(CMD_INFO_LINE, sent[1]);
+  CHECK_EQUAL(receiver.getFrequency(), (sent[3] << 7) | sent[4]);
+}
+
+TEST(watch_reacquire_stays_in_band)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+
+  watchSetup(rx);
+  receiver.setFrequency(FREQUENCY_MAX);
+  halSetAnalog(RSSI_PIN, []() {
+    if (watchRx->frequency() > watchMaxTuned)
+      watchMaxTuned = watchRx->frequency();
+    return watchRx->frequency() > FREQUENCY_MAX ? 500 : 150;
+  });
+  CHECK_EQUAL(0, reacquireSignal(FREQUENCY_MAX, 300));
+  CHECK(watchMaxTuned <= FREQUENCY_MAX);
+  CHECK_EQUAL(FREQUENCY_MAX, receiver.getFrequency());
+}
+
+/******************************************************************************
+   Clicks and debug page
+ ******************************************************************************/
+TEST(menu_very_long_click_is_long)
+{
+  clickType = VERY_LONG_CLICK;
+  CHECK_EQUAL(LONG_CLICK, getMenuClickType( BUTTON_PIN ));
+  clickType = VERY_LONG_CLICK;
+  CHECK_EQUAL(VERY_LONG_CLICK, getClickType( BUTTON_PIN ));
+}
+
+TEST(debug_line_fits_screen)
+{
+  size_t start = halSerialOutput().size();
+  const unsigned long values[3] = { 5, 28852, 4294967295UL };
+  std::string expected = std::string("\xFF\x0E\x01\xFF\x0F\x02" "loop min avg max" "\xFF\x0E\x11") +
+                         "   5 2e4 4e9";
+  std::vector<uint8_t> sent;
+
+  Serial.begin(57600);
+  drawDebugLine( 2, "loop min avg max", values, 3 );
+  sent = serialSince(start);
+  CHECK(std::string(sent.begin(), sent.end()) == expected);
+  CHECK_EQUAL(OSD_COLUMNS - 1, osdCursorX);
+}
+
+/******************************************************************************
+   MinimOSD protocol
+ ******************************************************************************/
+TEST(osd_encoders)
+{
+  size_t start = halSerialOutput().size();
+  const uint8_t expected[] = { CMD_CMD, CMD_CLEAR_SCREEN, CMD_CMD, CMD_SET_X, 4,
+                               '1', '2', '3', 'a', 'b', 0x0D };
+
+  Serial.begin(57600);
+  osd(CMD_CLEAR_SCREEN);
+  osd(CMD_SET_X, 4);
+  osd_int(123);
+  osd_string("ab");
+  osd_char(OSD_MHZ);
+  CHECK(serialSince(start) == std::vector<uint8_t>(expected, expected + sizeof(expected)));
+  CHECK_EQUAL(sizeof(expected), osdSent);
+  CHECK_EQUAL(10, osdCursorX);
+}
+
+TEST(osd_numbers_above_int16)
+{
+  size_t start = halSerialOutput().size();
+  const uint8_t expected[] = { '4', '0', '0', '0', '0', '7', '0', '0', '0', '0' };
+
+  Serial.begin(57600);
+  osd_int(40000);
+  osd_long(70000);
+  CHECK(serialSince(start) == std::vector<uint8_t>(expected, expected + sizeof(expected)));
+}
+
+TEST(osd_status_frame)
+{
+  Serial.begin(57600);
+  receiveStatus(halNow() + HAL_NS_PER_MS, 300, 2, 0xBEEF);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  CHECK_EQUAL(120, osdBufferSize);
+  CHECK_EQUAL(302, osdConsumed);        // Lost bytes count as consumed
+  CHECK_EQUAL(VIDEO_PAL, osdVideoFormat);
+  CHECK_EQUAL(2, osdOverflows);
+  CHECK_EQUAL(0xBEEF, osdTemplateHash);
+  CHECK_EQUAL(302, osdSent);            // First frame starts the counting
+  CHECK_EQUAL(120, osd_credits());
+  osd_string("hello");
+  CHECK_EQUAL(115, osd_credits());
+}
+
+TEST(osd_status_lost_bytes_return_credits)
+{
+  Serial.begin(57600);
+  receiveStatus(halNow() + HAL_NS_PER_MS, 0, 0, 0);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  osd_string("hello");
+  CHECK_EQUAL(115, osd_credits());
+
+  // Two of the five bytes were lost in the MinimOSD receiver
+  receiveStatus(halNow() + HAL_NS_PER_MS, 3, 2, 0);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  CHECK_EQUAL(5, osdConsumed);
+  CHECK_EQUAL(120, osd_credits());
+
+  // More losses than a 7 bit count holds
+  osd_string("hello");
+  receiveStatus(halNow() + HAL_NS_PER_MS, 3, 200, 0);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  CHECK_EQUAL(203, osdConsumed);
+  CHECK_EQUAL(120, osd_credits());
+}
+
+TEST(osd_status_restart_resyncs)
+{
+  Serial.begin(57600);
+  receiveStatus(halNow() + HAL_NS_PER_MS, 0, 0, 0, 5);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  osd_string("hello");
+
+  // The MinimOSD restarts before the bytes are consumed
+  receiveStatus(halNow() + HAL_NS_PER_MS, 0, 0, 0, 6);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  CHECK_EQUAL(0, osdSent);
+  CHECK_EQUAL(120, osd_credits());
+}
+
+TEST(osd_status_bad_check)
+{
+  Serial.begin(57600);
+  halSerialReceive(halNow() + HAL_NS_PER_MS, STATUS_START);
+  for (int i = 0; i < STATUS_PARAMS + 1; i++)
+    halSerialReceive(halNow() + HAL_NS_PER_MS, i == 0 ? STATUS_FRAME : 5);
+  halAdvance(2 * HAL_NS_PER_MS);
+  osd_poll();
+  CHECK_EQUAL(0, osdBufferSize);
+}
+
+/******************************************************************************
+   Templates
+ ******************************************************************************/
+TEST(template_hash_stored_when_confirmed)
+{
+  Serial.begin(OSD_BAUD_RATE);
+  templateHash = templateImage(false);
+  fakeOsdHash = templateHash;
+  fakeMinimOsd();
+  waitForOsd(100);
+  uploadTemplates();
+  CHECK_EQUAL(templateHash, storedTemplateHash());
+}
+
+TEST(template_hash_not_stored_unconfirmed)
+{
+  Serial.begin(OSD_BAUD_RATE);
+  templateHash = templateImage(false);
+  uploadTemplates();                        // No status frames
+  CHECK_EQUAL(0xFFFF, storedTemplateHash());
+
+  fakeOsdHash = templateHash ^ 1;           // The MinimOSD fails to store them
+  fakeMinimOsd();
+  waitForOsd(100);
+  for (int i = 0; i < 10; i++)
+    updateTemplates();
+  CHECK_EQUAL(TEMPLATE_UPLOAD_TRIES, templateUploads);
+  CHECK_EQUAL(0xFFFF, storedTemplateHash());
+}
+
+/******************************************************************************
+   Recordings of screens, rendered by minimosd_host for the golden tests.
+   A recording has one sent byte per line: its time in ns and its value.
+   Besides the screens of CYCLOP++ the recordings cover the protocol commands
+   that are not visible on the other screens.
+ ******************************************************************************/
+#define RECORD_VOLTAGE_ADC  600     // 12.0 V, 75 % of a 3s lipo
+#define RECORD_RSSI_ADC     321
+
+/* Sends the CYCLOP++ boot traffic and draws a screen
+   return : false if the screen is unknown */
+static bool drawScreen(const char *screen)
+{
+  unsigned char i;
+
+  halSetAnalog(VOLTAGE_METER_PIN, []() { return RECORD_VOLTAGE_ADC; });
+  halSetAnalog(RSSI_PIN, []() { return RECORD_RSSI_ADC; });
+  Serial.begin(OSD_BAUD_RATE);
+  resetOptions();
+  currentChannel = bestChannelMatch(5658);
+  receiver.setFrequency(getFrequency(currentChannel));
+  uploadTemplates();
+  osd( CMD_CLEAR_SCREEN );
+
+  if (!strcmp(screen, "start"))
+    drawStartScreen();
+  else if (!strcmp(screen, "options")) {
+    drawStartScreen();
+    drawOptionsScreen( 2, 0 );
+  }
+  else if (!strcmp(screen, "scanner")) {
+    drawScannerScreen();
+    for (i = 0; i < OSD_COLUMNS; i++)
+      updateScannerScreen( i, (i * 7) % 25, (i * 11) % 25 );
+    drawScannerCursor( 12, 5800 );
+  }
+  else if (!strcmp(screen, "info_line"))
+    drawInfoLine();
+  else if (!strcmp(screen, "templates")) {
+    // Templates are positioned relative to the draw position
+    drawLogo( 11, 4 );
+    osd_template( TEMPLATE_SCANNER_LABELS_L, 0, 8 );
+    osd_template( MAX_TEMPLATES - 1, 5, 10 );
+  }
+  else if (!strcmp(screen, "survey")) {
+    // Full scale RSSI puts CMD_CMD bytes in the survey frames
+    halSetAnalog(RSSI_PIN, []() { return 1023; });
+    pinMode(BUTTON_PIN, INPUT_PULLUP);
+    halPress(BUTTON_PIN, halNow() + 2000 * HAL_NS_PER_MS, 3000 * HAL_NS_PER_MS);
+    survey();
+    osd( CMD_SET_X, 1 );
+    osd( CMD_SET_Y, 2 );
+    osd_string( "done" );
+  }
+  else if (!strcmp(screen, "los_warning")) {
+    osd( CMD_SET_LOS_MODE, LOS_WARNING );
+    drawStartScreen();
+  }
+  else
+    return false;
+  Serial.flush();
+  return true;
+}
+
+static int record(const char *screen, const char *file)
+{
+  const std::vector<HalByte> &output = halSerialOutput();
+  FILE *out;
+
+  if (!drawScreen(screen)) {
+    fprintf(stderr, "Unknown screen %s\n", screen);
+    return 2;
+  }
+  out = fopen(file, "w");
+  if (!out) {
+    perror(file);
+    return 2;
+  }
+  for (size_t i = 0; i < output.size(); i++)
+    fprintf(out, "%llu %u\n", (unsigned long long)output[i].time, output[i].data);
+  fclose(out);
+  return 0;
+}
+
+/******************************************************************************
+   Scan benchmark. autoScan runs against simulated RF scenes from a number of
+   start frequencies, each run in its own process. The expected lock is the
+   first transmitter above the start frequency, as autoScan skips the
+   current channel and scans upwards.
+ ******************************************************************************/
+#define SCAN_MAX_TRIALS     24
+
+struct ScanScene
+{
+  const char *name;
+  void (*build)(RfScene &scene);
+  bool lBand;
+};
+
+struct ScanTrial
+{
+  const ScanScene *scene;
+  unsigned int start;
+};
+
+struct ScanResult
+{
+  unsigned int frequency;       // Returned by autoScan
+  unsigned int expected;        // Frequency of the expected transmitter at the end
+  unsigned long tunes;
+  double lockMs;
+};
+
+static void sceneSolo(RfScene &scene)
+{
+  scene.setNoise(140, 0, 4);
+  scene.add({ 5800, 38, 18, 0 });
+}
+
+/* Eight pilots on raceband at different distances */
+static void sceneRace(RfScene &scene)
+{
+  const double powers[8] = { 42, 30, 36, 24, 40, 28, 34, 45 };
+  const double drifts[8] = { 0.1, -0.2, 0, 0.3, -0.1, 0, 0.2, -0.3 };
+
+  scene.setNoise(150, 0, 6);
+  for (int i = 0; i < 8; i++)
+    scene.add({ 5658.0 + 37 * i, powers[i], 18, drifts[i] });
+}
+
+/* Transmitters close together in the low band, which is noisier */
+static void sceneCrowdedLow(RfScene &scene)
+{
+  const double frequencies[7] = { 5362, 5380, 5399, 5436, 5447, 5510, 5584 };
+  const double powers[7] = { 30, 22, 35, 26, 33, 20, 38 };
+
+  scene.setNoise(145, 10, 8);
+  for (int i = 0; i < 7; i++)
+    scene.add({ frequencies[i], powers[i], 18, 0 });
+}
+
+/* One transmitter over a noise floor, with more noise on higher floors */
+template <int floor, int power>
+static void sceneNoise(RfScene &scene)
+{
+  scene.setNoise(floor, 0, floor / 30.0);
+  scene.add({ 5800, power, 18, 0 });
+}
+
+static const ScanScene scanScenes[] = {
+  { "solo",       sceneSolo,       false },
+  { "race",       sceneRace,       false },
+  { "crowded_low", sceneCrowdedLow, true  },
+  // 11 and 25 dB are about 90 and 200 ADC steps above the floor
+  { "noise150_weak",   sceneNoise<150, 11>, false },
+  { "noise150_strong", sceneNoise<150, 25>, false },
+  { "noise200_weak",   sceneNoise<200, 11>, false },
+  { "noise200_strong", sceneNoise<200, 25>, false },
+  { "noise250_weak",   sceneNoise<250, 11>, false },
+  { "noise250_strong", sceneNoise<250, 25>, false },
+  { "noise300_weak",   sceneNoise<300, 11>, false },
+  { "noise300_strong", sceneNoise<300, 25>, false }
+};
+
+/* Transmitter autoScan should find when starting at a frequency */
+static const Transmitter *expectedTransmitter(const RfScene &scene, unsigned int start)
+{
+  const std::vector<Transmitter> &transmitters = scene.transmitters();
+  int span = FREQUENCY_MAX - FREQUENCY_MIN + SCANNING_STEP;
+  const Transmitter *best = 0;
+  int bestDistance = span;
+  int distance;
+
+  for (size_t i = 0; i < transmitters.size(); i++) {
+    distance = (((int)transmitters[i].frequency - (int)(start + 10)) % span + span) % span;
+    if (distance < bestDistance) {
+      bestDistance = distance;
+      best = &transmitters[i];
+    }
+  }
+  return best;
+}
+
+static void runScanTrial(void *result, const void *arg)
+{
+  const ScanTrial &trial = *(const ScanTrial *)arg;
+  ScanResult &scan = *(ScanResult *)result;
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+  uint64_t start;
+  unsigned long tunes;
+
+  trial.scene->build(scene);
+  halSetAnalog(RSSI_PIN, [&scene]() { return scene.rssi(); });
+  Serial.begin(OSD_BAUD_RATE);
+  resetOptions();
+  options[L_BAND_OPTION] = trial.scene->lBand;
+  updateSoftPositions();
+  receiver.begin();
+  measureNoiseFloor();                       // As setup does
+  receiver.setFrequency(trial.start);
+  delay(100);
+
+  halSetDeadline(halNow() + 60000 * HAL_NS_PER_MS);
+  start = halNow();
+  tunes = rx.tunes();
+  scan.frequency = autoScan(trial.start);
+  scan.lockMs = (halNow() - start) / 1e6;
+  scan.tunes = rx.tunes() - tunes;
+  scan.expected = scene.frequencyOf(*expectedTransmitter(scene, trial.start), halNow()) + 0.5;
+}
+
+/* Start frequencies: each transmitter and evenly spread over the band */
+static unsigned char scanStarts(const ScanScene &scene, unsigned int *starts)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene rf(rx);
+  unsigned int low = scene.lBand ? 5345 : 5645;
+  unsigned char count = 0;
+
+  scene.build(rf);
+  for (size_t i = 0; (i < rf.transmitters().size()) && (count < SCAN_MAX_TRIALS); i++)
+    starts[count++] = rf.transmitters()[i].frequency;
+  for (unsigned int f = low; (f < 5945) && (count < SCAN_MAX_TRIALS); f += (5945 - low) / 6)
+    starts[count++] = f;
+  return count;
+}
+
+static int scanBenchmark(const char *name)
+{
+  unsigned int starts[SCAN_MAX_TRIALS];
+  unsigned char count;
+  unsigned char wrong;
+  double lockSum, lockMax;
+  unsigned long tunes;
+  ScanTrial trial;
+  ScanResult result;
+  bool found = false;
+
+  printf("%-16s %6s %14s %14s %8s %8s\n", "scene", "trials", "lock ms mean", "lock ms max", "wrong", "tunes");
+  for (size_t s = 0; s < sizeof(scanScenes) / sizeof(scanScenes[0]); s++) {
+    if (name && strcmp(name, scanScenes[s].name))
+      continue;
+    found = true;
+    count = scanStarts(scanScenes[s], starts);
+    wrong = 0;
+    lockSum = lockMax = 0;
+    tunes = 0;
+    trial.scene = &scanScenes[s];
+    for (unsigned char i = 0; i < count; i++) {
+      trial.start = starts[i];
+      if (!hostRunIsolated(runScanTrial, &trial, &result, sizeof(result))) {
+        fprintf(stderr, "%s: trial from %u MHz failed\n", scanScenes[s].name, starts[i]);
+        return 1;
+      }
+      // Wrong channel: the lock is not on the channel of the transmitter
+      if (getFrequency(bestChannelMatch(result.frequency)) != getFrequency(bestChannelMatch(result.expected)) ||
+          (abs((int)result.frequency - (int)result.expected) > 10))
+        wrong++;
+      lockSum += result.lockMs;
+      lockMax = result.lockMs > lockMax ? result.lockMs : lockMax;
+      tunes += result.tunes;
+    }
+    printf("%-16s %6u %14.0f %14.0f %7.0f%% %8.1f\n", scanScenes[s].name, count,
+           lockSum / count, lockMax, 100.0 * wrong / count, (double)tunes / count);
+  }
+  if (!found) {
+    fprintf(stderr, "Unknown scene %s\n", name);
+    return 2;
+  }
+  return 0;
+}
+
+/******************************************************************************
+   Firmware benchmarks. runBenchmarks runs as it does on the Atmega with
+   BENCHMARKS set, and its results are taken from the OSD text it sends.
+   graphicScanner then sweeps the band until the button stops it, and its
+   mean sweep time is added. The times are in virtual microseconds, from the
+   cycle costs of the Arduino core calls and the modelled serial line, RX5808
+   and ADC. They are estimates: the sketch code between the core calls takes
+   no time.
+ ******************************************************************************/
+#define BENCH_PRESS_MS      30000   // Ends the result display of runBenchmarks
+#define BENCH_SWEEPS_MS     10000   // Sweeping time of graphicScanner
+
+/* Runs graphicScanner for BENCH_SWEEPS_MS and returns its mean sweep time.
+   The very long click takes the cursor frequency without zooming. */
+static unsigned long sweepBenchmark(void)
+{
+  const uint64_t press[][2] = { { 0, 500 }, { 1000, 3500 } };
+  uint64_t start;
+
+  // Let go of the button that ended runBenchmarks. Clicks are taken from
+  // here on, as setup does.
+  delay( 1000 );
+  enableInterrupt(BUTTON_PIN, buttonPressInterrupt, CHANGE);
+  resetProfiling();
+  start = halNow() + BENCH_SWEEPS_MS * HAL_NS_PER_MS;
+  for (size_t i = 0; i < sizeof(press) / sizeof(press[0]); i++)
+    halPress(BUTTON_PIN, start + press[i][0] * HAL_NS_PER_MS, press[i][1] * HAL_NS_PER_MS);
+  graphicScanner( getFrequency(currentChannel) );
+  return averageSample( profileSweep );
+}
+
+static int firmwareBenchmark(const char *file)
+{
+  const std::vector<HalByte> &output = halSerialOutput();
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  std::string results;
+  size_t start = 0;
+  FILE *out;
+
+  halSetAnalog(VOLTAGE_METER_PIN, []() { return RECORD_VOLTAGE_ADC; });
+  halSetAnalog(RSSI_PIN, []() { return RECORD_RSSI_ADC; });
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  Serial.begin(OSD_BAUD_RATE);
+  resetOptions();
+  receiver.begin();
+  halPress(BUTTON_PIN, halNow() + BENCH_PRESS_MS * HAL_NS_PER_MS, 100 * HAL_NS_PER_MS);
+  runBenchmarks();
+
+  // The results follow the last screen clear, one line per CMD_NEWLINE
+  for (size_t i = 1; i < output.size(); i++)
+    if ((output[i - 1].data == CMD_CMD) && (output[i].data == CMD_CLEAR_SCREEN))
+      start = i + 1;
+  for (size_t i = start; i < output.size(); i++) {
+    if (output[i].data == CMD_CMD) {
+      if (output[++i].data == CMD_NEWLINE)
+        results += '\n';
+    }
+    else
+      results += (char)output[i].data;
+  }
+  results = "scannersweep " + std::to_string(sweepBenchmark()) + "\n" + results;
+
+  out = fopen(file, "w");
+  if (!out) {
+    perror(file);
+    return 2;
+  }
+  fputs("# name us-per-call\n# screen bytes commands redundant-moves wire-ms\n", out);
+  fputs(results.c_str(), out);
+  fclose(out);
+  fputs(results.c_str(), stdout);
+  return 0;
+}
+
+/******************************************************************************
+   RF scenes
+ ******************************************************************************/
+TEST(rf_scene_settling)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+  int early, settled;
+
+  scene.add({ 5800, 40, 18, 0 });
+  receiver.begin();
+  receiver.setFrequency(5645);
+  delay(50);
+  CHECK_EQUAL(140, scene.rssi());
+  receiver.setFrequency(5801);
+  delayMicroseconds(500);
+  early = scene.rssi();
+  delay(RSSI_STABILITY_DELAY_MS);
+  settled = scene.rssi();
+  CHECK(early < 140 + (settled - 140) / 2);
+  CHECK(settled > 140 + 310);
+  delay(100);
+  CHECK_EQUAL(140 + 320, scene.rssi());           // 40 dB at 8 ADC steps per dB
+}
+
+TEST(rf_scene_bleed_and_drift)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+
+  scene.add({ 5800, 40, 18, 1 });
+  scene.setBleed(30, 60);
+  CHECK(scene.settledRssi(5800, 0) > scene.settledRssi(5810, 0));
+  CHECK_EQUAL(140 + 83, (int)(scene.settledRssi(5840, 0) + 0.5));    // Floor plus 10 dB of bleed
+  CHECK((int)(scene.settledRssi(5900, 0) + 0.5) == 140);
+  CHECK_EQUAL(5810, (int)scene.frequencyOf(scene.transmitters()[0], 10000 * HAL_NS_PER_MS));
+}
+
+TEST(scan_solo_locks)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+  unsigned int frequency;
+
+  sceneSolo(scene);
+  halSetAnalog(RSSI_PIN, [&scene]() { return scene.rssi(); });
+  Serial.begin(OSD_BAUD_RATE);
+  resetOptions();
+  receiver.begin();
+  frequency = autoScan(5658);
+  CHECK(abs((int)frequency - 5800) <= 2);
+  CHECK_EQUAL(5800, getFrequency(bestChannelMatch(frequency)));
+}
+
+TEST(scan_noise_floor_measured)
+{
+  Rx5808 rx( SPI_CLOCK_PIN, SLAVE_SELECT_PIN, SPI_DATA_PIN );
+  RfScene scene(rx);
+  unsigned char segment;
+  unsigned int lowest = 1023;
+
+  sceneNoise<300, 25>(scene);
+  halSetAnalog(RSSI_PIN, [&scene]() { return scene.rssi(); });
+  resetOptions();
+  receiver.begin();
+  readCalibration();
+  rssiMax = 1023;                             // A single strong sample
+  measureNoiseFloor();
+  for (segment = noiseSegment(FREQUENCY_MIN); segment < NOISE_SEGMENTS; segment++) {
+    CHECK(abs((int)noiseFloor[segment] - 300) <= 20);     // Jitter and bleed
+    lowest = noiseFloor[segment] < lowest ? noiseFloor[segment] : lowest;
+  }
+  CHECK_EQUAL(lowest, rssiMin);
+  CHECK(rssiMax - rssiMin < 1023 - 300);     // The range decays
+  CHECK(rssiMax - rssiMin > RSSI_RANGE_MIN);
+  CHECK(calibrationChanged);
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc >= 2) && !strcmp(argv[1], "test"))
+    return hostRunTests(argc > 2 ? argv[2] : 0);
+  if ((argc == 4) && !strcmp(argv[1], "record"))
+    return record(argv[2], argv[3]);
+  if ((argc >= 2) && !strcmp(argv[1], "scan"))
+    return scanBenchmark(argc > 2 ? argv[2] : 0);
+  if ((argc == 3) && !strcmp(argv[1], "bench"))
+    return firmwareBenchmark(argv[2]);
+  fprintf(stderr, "Usage: cyclop_host test [name prefix]\n"
+                  "       cyclop_host record <screen> <file>\n"
+                  "         screen: start options scanner info_line templates survey los_warning\n"
+                  "       cyclop_host scan [scene]\n"
+                  "         scene: solo race crowded_low noise<150|200|250|300>_<weak|strong>\n"
+                  "       cyclop_host bench <result file>\n");
+  return 2;
+}
@@ -0,0 +1,18 @@
+# Font test. Runs "character generation/mcm2font.py" on the .mcm and compares
+# the result with the font.h of the sketch, so that font.h can not drift from
+# the .mcm or from the compressor.
+#
+# Variables: PYTHON, FONT_DIR, OUTPUT_DIR
+set(FONT ${OUTPUT_DIR}/font.h)
+
+execute_process(COMMAND ${PYTHON} "${FONT_DIR}/character generation/mcm2font.py"
+                        "${FONT_DIR}/character generation/minimosd_for_cyclop.mcm" ${FONT}
+                RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "mcm2font.py failed")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${FONT_DIR}/font.h ${FONT}
+                RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "${FONT_DIR}/font.h is not what mcm2font.py makes of the .mcm, see ${FONT}")
+endif()
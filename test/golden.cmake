@@ -0,0 +1,30 @@
+# Golden screen test. Records the bytes CYCLOP++ sends for a screen, renders
+# them with the MinimOSD and the MAX7456 model and compares the text with
+# golden/<screen>.txt. An image of the screen drawn with the real font is left
+# next to the text in the build folder. Run ctest with UPDATE_GOLDEN=1 in the
+# environment to replace the golden files after an intended screen change.
+#
+# Variables: CYCLOP_HOST, MINIMOSD_HOST, SCREEN, RENDER_OPTIONS, GOLDEN_DIR, OUTPUT_DIR
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+set(RECORDING ${OUTPUT_DIR}/${SCREEN}.rec)
+set(TEXT ${OUTPUT_DIR}/${SCREEN}.txt)
+
+execute_process(COMMAND ${CYCLOP_HOST} record ${SCREEN} ${RECORDING} RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "Recording of ${SCREEN} failed")
+endif()
+execute_process(COMMAND ${MINIMOSD_HOST} render ${RENDER_OPTIONS} ${RECORDING} ${TEXT} ${OUTPUT_DIR}/${SCREEN}.pgm
+                RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "Rendering of ${SCREEN} failed")
+endif()
+
+if(DEFINED ENV{UPDATE_GOLDEN})
+  file(COPY ${TEXT} DESTINATION ${GOLDEN_DIR})
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${GOLDEN_DIR}/${SCREEN}.txt ${TEXT}
+                RESULT_VARIABLE result)
+if(result)
+  file(READ ${TEXT} rendered)
+  message(FATAL_ERROR "${SCREEN} differs from ${GOLDEN_DIR}/${SCREEN}.txt:\n${rendered}")
+endif()
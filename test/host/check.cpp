@@ -0,0 +1,137 @@
+/*****************************************************************************
+   File: check.cpp
+
+   Author: Kjell Kernen
+
+   Test registry and runner of the host build, see check.h
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "check.h"
+#include "hal.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define MAX_TESTS 128
+
+namespace {
+
+struct HostTest
+{
+  const char *name;
+  HostTestFunction run;
+};
+
+HostTest tests[MAX_TESTS];
+int testCount = 0;
+
+} // namespace
+
+int hostTestAdd(const char *name, HostTestFunction run)
+{
+  if (testCount < MAX_TESTS) {
+    tests[testCount].name = name;
+    tests[testCount].run = run;
+    testCount++;
+  }
+  return testCount;
+}
+
+void hostCheckFailed(const char *file, int line, const char *expression)
+{
+  fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+  exit(1);
+}
+
+void hostCheckEqualFailed(const char *file, int line, const char *expression, long long expected, long long actual)
+{
+  fprintf(stderr, "%s:%d: check failed: %s is %lld, expected %lld\n", file, line, expression, actual, expected);
+  exit(1);
+}
+
+int hostRunTests(const char *filter)
+{
+  int failed = 0;
+  int run = 0;
+  int status;
+  pid_t pid;
+
+  for (int i = 0; i < testCount; i++) {
+    if (filter && strncmp(tests[i].name, filter, strlen(filter)))
+      continue;
+    fflush(stdout);
+    pid = fork();
+    if (pid == 0) {
+      try {
+        tests[i].run();
+      }
+      catch (HalDeadline &) {
+        fprintf(stderr, "%s: virtual time ran out\n", tests[i].name);
+        exit(1);
+      }
+      exit(0);
+    }
+    waitpid(pid, &status, 0);
+    run++;
+    if (WIFEXITED(status) && !WEXITSTATUS(status))
+      printf("ok   %s\n", tests[i].name);
+    else {
+      printf("FAIL %s\n", tests[i].name);
+      failed++;
+    }
+  }
+  printf("%d tests, %d failed\n", run, failed);
+  return (failed || !run) ? 1 : 0;
+}
+
+bool hostRunIsolated(void (*run)(void *result, const void *arg), const void *arg, void *result, size_t size)
+{
+  int channel[2];
+  int status;
+  size_t received = 0;
+  ssize_t count;
+  pid_t pid;
+
+  if (pipe(channel))
+    return false;
+  fflush(stdout);
+  pid = fork();
+  if (pid == 0) {
+    close(channel[0]);
+    try {
+      run(result, arg);
+    }
+    catch (HalDeadline &) {
+      fprintf(stderr, "virtual time ran out\n");
+      exit(1);
+    }
+    if (write(channel[1], result, size) != (ssize_t)size)
+      exit(1);
+    exit(0);
+  }
+  close(channel[1]);
+  while ((received < size) && ((count = read(channel[0], (char *)result + received, size - received)) > 0))
+    received += count;
+  close(channel[0]);
+  waitpid(pid, &status, 0);
+  return (received == size) && WIFEXITED(status) && !WEXITSTATUS(status);
+}
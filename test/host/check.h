@@ -0,0 +1,67 @@
+/*****************************************************************************
+   File: check.h
+
+   Author: Kjell Kernen
+
+   Minimal unit test support of the host build. Each test runs in its own
+   process, so the globals and static locals of the firmware start fresh.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stddef.h>
+
+typedef void (*HostTestFunction)(void);
+
+/* Registers a test, used by TEST */
+int hostTestAdd(const char *name, HostTestFunction run);
+
+/* Runs the tests whose names start with filter (all if 0)
+   return : the exit code, 0 if all tests passed */
+int hostRunTests(const char *filter);
+
+/* Runs a function in its own process, like a test. The function fills in
+   size bytes of result, which are copied back to the caller.
+   return : true if the function returned */
+bool hostRunIsolated(void (*run)(void *result, const void *arg), const void *arg, void *result, size_t size);
+
+void hostCheckFailed(const char *file, int line, const char *expression);
+void hostCheckEqualFailed(const char *file, int line, const char *expression, long long expected, long long actual);
+
+#define TEST(name) \
+  static void test_##name(void); \
+  static int testAdded_##name __attribute__((unused)) = hostTestAdd(#name, test_##name); \
+  static void test_##name(void)
+
+#define CHECK(condition) \
+  do { if (!(condition)) hostCheckFailed(__FILE__, __LINE__, #condition); } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+  do { \
+    long long expected_ = (expected); \
+    long long actual_ = (actual); \
+    if (expected_ != actual_) \
+      hostCheckEqualFailed(__FILE__, __LINE__, #actual, expected_, actual_); \
+  } while (0)
+
+#endif /* CHECK_H */
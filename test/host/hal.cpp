@@ -0,0 +1,839 @@
+/*****************************************************************************
+   File: hal.cpp
+
+   Author: Kjell Kernen
+
+   Arduino core and Atmega 328 peripherals of the host build, see hal.h
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "hal.h"
+#include <SPI.h>
+#include <EEPROM.h>
+#include <EnableInterrupt.h>
+#include <deque>
+#include <map>
+
+/* Cost of core calls in CPU cycles, roughly as measured on the Atmega 328 */
+#define CYCLES_MILLIS         30
+#define CYCLES_MICROS         40
+#define CYCLES_PIN_MODE       60
+#define CYCLES_DIGITAL_WRITE  55
+#define CYCLES_DIGITAL_READ   50
+#define CYCLES_ANALOG_WRITE   70
+#define CYCLES_SERIAL_WRITE   50
+#define CYCLES_SERIAL_READ    30
+#define CYCLES_SERIAL_STATUS  20
+#define CYCLES_SPI_TRANSFER   17
+#define CYCLES_SPI_SETUP      20
+#define CYCLES_EEPROM         20
+
+#define ADC_CONVERSION_NS     104000ULL   // 13 ADC clocks at 125 kHz
+#define EEPROM_WRITE_NS       3400000ULL  // Erase and write of one byte
+#define EEPROM_SIZE_BYTES     1024
+
+#define PORT_B  2
+#define PORT_C  3
+#define PORT_D  4
+
+HardwareSerial Serial;
+SPIClass SPI;
+EEPROMClass EEPROM;
+
+HalUdr UDR0;
+HalUcsr0b UCSR0B;
+volatile uint8_t UCSR0A;
+volatile uint8_t UCSR0C;
+volatile uint8_t UBRR0H;
+volatile uint8_t UBRR0L;
+volatile uint8_t PORTB;
+volatile uint8_t PORTC;
+volatile uint8_t PORTD;
+
+extern "C" void USART_RX_vect(void) __attribute__((weak));
+extern "C" void USART_UDRE_vect(void) __attribute__((weak));
+
+namespace {
+
+struct PinInterrupt
+{
+  void (*handler)(void);
+  int mode;
+};
+
+struct SpiSlave
+{
+  uint8_t csPin;
+  SpiDevice *device;
+  bool selected;
+};
+
+uint64_t now = 0;
+uint64_t deadline = 0;
+std::multimap<uint64_t, std::function<void(void)> > events;
+int interruptsOff = 0;
+bool inInterrupt = false;
+
+uint8_t pinModes[NUM_PINS];
+int inputLevels[NUM_PINS] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                              -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+PinInterrupt pinInterrupts[NUM_PINS];
+std::vector<std::function<void(uint8_t, uint8_t)> > pinListeners;
+std::function<int(void)> analogSources[NUM_PINS];
+int analogOutputs[NUM_PINS];
+
+std::vector<SpiSlave> spiSlaves;
+uint32_t spiClock = F_CPU / 4;
+unsigned long spiTransactions = 0;
+
+std::vector<uint8_t> eeprom(EEPROM_SIZE_BYTES, 0xFF);
+uint64_t eepromReady = 0;
+unsigned long eepromWrites = 0;
+
+uint64_t serialByteTime = 0;
+uint64_t serialTxEnd = 0;
+std::vector<HalByte> serialOutput;
+std::deque<uint8_t> serialInput;
+
+uint8_t uartRxData = 0;
+uint64_t uartTxEnd = 0;
+bool uartDraining = false;
+std::vector<HalByte> uartOutput;
+
+/* Runs due events as interrupts, one at a time */
+void runEvents(void)
+{
+  std::function<void(void)> event;
+
+  while (!interruptsOff && !inInterrupt && !events.empty() && (events.begin()->first <= now)) {
+    event = events.begin()->second;
+    events.erase(events.begin());
+    inInterrupt = true;
+    event();
+    inInterrupt = false;
+  }
+}
+
+volatile uint8_t *pinPort(uint8_t pin)
+{
+  return portOutputRegister(digitalPinToPort(pin));
+}
+
+int pinLevel(uint8_t pin)
+{
+  if (pinModes[pin] == OUTPUT)
+    return (*pinPort(pin) & digitalPinToBitMask(pin)) ? HIGH : LOW;
+  if (inputLevels[pin] >= 0)
+    return inputLevels[pin];
+  return (pinModes[pin] == INPUT_PULLUP) ? HIGH : LOW;
+}
+
+/* Selects and deselects SPI devices as their ~CS pins have changed */
+void spiSync(void)
+{
+  bool low;
+
+  for (size_t i = 0; i < spiSlaves.size(); i++) {
+    low = !(*pinPort(spiSlaves[i].csPin) & digitalPinToBitMask(spiSlaves[i].csPin));
+    if (low && !spiSlaves[i].selected) {
+      spiSlaves[i].selected = true;
+      spiSlaves[i].device->select();
+    }
+    else if (!low && spiSlaves[i].selected) {
+      spiSlaves[i].selected = false;
+      spiSlaves[i].device->deselect();
+    }
+  }
+}
+
+void eepromWait(void)
+{
+  if (now < eepromReady)
+    halAdvance(eepromReady - now);
+}
+
+/* Bytes waiting in the transmit buffer, the byte being sent is not counted */
+int serialQueued(void)
+{
+  int queued = 0;
+
+  for (size_t i = serialOutput.size(); i && (serialOutput[i - 1].time - serialByteTime > now); i--)
+    queued++;
+  return queued;
+}
+
+char *formatNumber(uint32_t value, bool negative, char *string, int radix)
+{
+  char digits[33];
+  char *p = string;
+  int count = 0;
+
+  do {
+    digits[count++] = "0123456789abcdefghijklmnopqrstuvwxyz"[value % radix];
+    value /= radix;
+  } while (value);
+  if (negative)
+    *p++ = '-';
+  while (count)
+    *p++ = digits[--count];
+  *p = 0;
+  return string;
+}
+
+} // namespace
+
+/******************************************************************************
+   Time
+ ******************************************************************************/
+uint64_t halNow(void)
+{
+  return now;
+}
+
+void halAdvance(uint64_t ns)
+{
+  uint64_t target = now + ns;
+
+  while (!interruptsOff && !inInterrupt && !events.empty() && (events.begin()->first <= target)) {
+    if (events.begin()->first > now)
+      now = events.begin()->first;
+    runEvents();
+  }
+  if (target > now)
+    now = target;
+  if (deadline && (now >= deadline) && !inInterrupt) {
+    deadline = 0;
+    throw HalDeadline();
+  }
+}
+
+void halSpend(unsigned long cycles)
+{
+  halAdvance(cycles * 1000000000ULL / F_CPU);
+}
+
+void halAt(uint64_t time, std::function<void(void)> event)
+{
+  events.insert(std::make_pair(time, event));
+}
+
+void halSetDeadline(uint64_t time)
+{
+  deadline = time;
+}
+
+void halDisableInterrupts(void)
+{
+  interruptsOff++;
+}
+
+void halEnableInterrupts(void)
+{
+  if (interruptsOff)
+    interruptsOff--;
+  runEvents();
+}
+
+unsigned long millis(void)
+{
+  halSpend(CYCLES_MILLIS);
+  return (uint32_t)(now / HAL_NS_PER_MS);
+}
+
+unsigned long micros(void)
+{
+  uint32_t us;
+
+  halSpend(CYCLES_MICROS);
+  us = now / HAL_NS_PER_US;
+  return us - us % (64000000UL / F_CPU);    // Timer 0 ticks every 64 cycles
+}
+
+void delay(unsigned long ms)
+{
+  halAdvance(ms * HAL_NS_PER_MS);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  halAdvance(us * HAL_NS_PER_US);
+}
+
+/******************************************************************************
+   Pins
+ ******************************************************************************/
+uint8_t digitalPinToPort(uint8_t pin)
+{
+  return (pin < 8) ? PORT_D : ((pin < 14) ? PORT_B : PORT_C);
+}
+
+uint8_t digitalPinToBitMask(uint8_t pin)
+{
+  return 1 << ((pin < 8) ? pin : ((pin < 14) ? pin - 8 : pin - 14));
+}
+
+volatile uint8_t *portOutputRegister(uint8_t port)
+{
+  return (port == PORT_B) ? &PORTB : ((port == PORT_C) ? &PORTC : &PORTD);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  halSpend(CYCLES_PIN_MODE);
+  pinModes[pin] = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  halSpend(CYCLES_DIGITAL_WRITE);
+  if (value)
+    *pinPort(pin) |= digitalPinToBitMask(pin);
+  else
+    *pinPort(pin) &= ~digitalPinToBitMask(pin);
+  for (size_t i = 0; i < pinListeners.size(); i++)
+    pinListeners[i](pin, value ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin)
+{
+  halSpend(CYCLES_DIGITAL_READ);
+  return pinLevel(pin);
+}
+
+int analogRead(uint8_t pin)
+{
+  int value = analogSources[pin] ? analogSources[pin]() : 0;
+
+  halAdvance(ADC_CONVERSION_NS);
+  return value < 0 ? 0 : (value > 1023 ? 1023 : value);
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+  halSpend(CYCLES_ANALOG_WRITE);
+  analogOutputs[pin] = value;
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*userFunc)(void), int mode)
+{
+  pinInterrupts[interruptNum ? 3 : 2].handler = userFunc;
+  pinInterrupts[interruptNum ? 3 : 2].mode = mode;
+}
+
+void detachInterrupt(uint8_t interruptNum)
+{
+  pinInterrupts[interruptNum ? 3 : 2].handler = 0;
+}
+
+void enableInterrupt(uint8_t pin, void (*userFunction)(void), uint8_t mode)
+{
+  pinInterrupts[pin].handler = userFunction;
+  pinInterrupts[pin].mode = mode;
+}
+
+void disableInterrupt(uint8_t pin)
+{
+  pinInterrupts[pin].handler = 0;
+}
+
+void halSetPin(uint8_t pin, uint8_t level)
+{
+  int before = pinLevel(pin);
+  int after;
+  PinInterrupt &interrupt = pinInterrupts[pin];
+
+  inputLevels[pin] = level;
+  after = pinLevel(pin);
+  if (interrupt.handler && (before != after) &&
+      ((interrupt.mode == CHANGE) || ((interrupt.mode == FALLING) && (after == LOW)) ||
+       ((interrupt.mode == RISING) && (after == HIGH)))) {
+    halAt(now, interrupt.handler);
+    runEvents();
+  }
+}
+
+int halPinOutput(uint8_t pin)
+{
+  return (*pinPort(pin) & digitalPinToBitMask(pin)) ? HIGH : LOW;
+}
+
+void halOnPinWrite(std::function<void(uint8_t pin, uint8_t level)> listener)
+{
+  pinListeners.push_back(listener);
+}
+
+void halSetAnalog(uint8_t pin, std::function<int(void)> source)
+{
+  analogSources[pin] = source;
+}
+
+int halAnalogOutput(uint8_t pin)
+{
+  return analogOutputs[pin];
+}
+
+void halPress(uint8_t pin, uint64_t time, uint64_t hold)
+{
+  halAt(time, [pin]() { halSetPin(pin, LOW); });
+  halAt(time + hold, [pin]() { halSetPin(pin, HIGH); });
+}
+
+/******************************************************************************
+   SPI
+ ******************************************************************************/
+void halAttachSpi(uint8_t csPin, SpiDevice *device)
+{
+  SpiSlave slave = { csPin, device, false };
+  spiSlaves.push_back(slave);
+}
+
+unsigned long halSpiTransactions(void)
+{
+  return spiTransactions;
+}
+
+void SPIClass::begin(void)
+{
+  halSpend(CYCLES_SPI_SETUP);
+}
+
+void SPIClass::end(void)
+{
+  halSpend(CYCLES_SPI_SETUP);
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  halSpend(CYCLES_SPI_SETUP);
+  spiTransactions++;
+  spiClock = settings.clock < F_CPU / 2 ? settings.clock : F_CPU / 2;
+  spiSync();
+}
+
+void SPIClass::endTransaction(void)
+{
+  halSpend(CYCLES_SPI_SETUP / 4);
+  spiSync();
+}
+
+void SPIClass::setClockDivider(uint8_t divider)
+{
+  spiClock = F_CPU / ((divider == SPI_CLOCK_DIV2) ? 2 : ((divider == SPI_CLOCK_DIV16) ? 16 : 4));
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  uint8_t result = 0;
+
+  spiSync();
+  halSpend(CYCLES_SPI_TRANSFER);
+  halAdvance(8 * 1000000000ULL / spiClock);
+  for (size_t i = 0; i < spiSlaves.size(); i++)
+    if (spiSlaves[i].selected)
+      result = spiSlaves[i].device->transfer(data);
+  return result;
+}
+
+/******************************************************************************
+   Heap. The C library allocation functions are wrapped to count the calls.
+ ******************************************************************************/
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+
+static unsigned long heapAllocations = 0;
+
+extern "C" void *malloc(size_t size)
+{
+  heapAllocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+  heapAllocations++;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, size_t size)
+{
+  heapAllocations++;
+  return __libc_realloc(pointer, size);
+}
+
+unsigned long halHeapAllocations(void)
+{
+  return heapAllocations;
+}
+
+/******************************************************************************
+   EEPROM
+ ******************************************************************************/
+uint8_t EEPROMClass::read(int address)
+{
+  halSpend(CYCLES_EEPROM);
+  eepromWait();
+  return eeprom[address % EEPROM_SIZE_BYTES];
+}
+
+void EEPROMClass::write(int address, uint8_t value)
+{
+  halSpend(CYCLES_EEPROM);
+  eepromWait();
+  eeprom[address % EEPROM_SIZE_BYTES] = value;
+  eepromReady = now + EEPROM_WRITE_NS;
+  eepromWrites++;
+}
+
+void EEPROMClass::update(int address, uint8_t value)
+{
+  if (read(address) != value)
+    write(address, value);
+}
+
+uint16_t EEPROMClass::length(void)
+{
+  return EEPROM_SIZE_BYTES;
+}
+
+uint8_t *halEeprom(void)
+{
+  return eeprom.data();
+}
+
+unsigned long halEepromWrites(void)
+{
+  return eepromWrites;
+}
+
+/******************************************************************************
+   Serial
+ ******************************************************************************/
+void HardwareSerial::begin(unsigned long baud)
+{
+  halSpend(CYCLES_PIN_MODE);
+  serialByteTime = 10 * 1000000000ULL / baud;   // 8N1 is 10 bits per byte
+}
+
+void HardwareSerial::end(void)
+{
+  flush();
+  serialByteTime = 0;
+}
+
+int HardwareSerial::available(void)
+{
+  halSpend(CYCLES_SERIAL_STATUS);
+  return serialInput.size();
+}
+
+int HardwareSerial::peek(void)
+{
+  halSpend(CYCLES_SERIAL_STATUS);
+  return serialInput.empty() ? -1 : serialInput.front();
+}
+
+int HardwareSerial::read(void)
+{
+  int data;
+
+  halSpend(CYCLES_SERIAL_READ);
+  if (serialInput.empty())
+    return -1;
+  data = serialInput.front();
+  serialInput.pop_front();
+  return data;
+}
+
+int HardwareSerial::availableForWrite(void)
+{
+  halSpend(CYCLES_SERIAL_STATUS);
+  return SERIAL_TX_BUFFER_SIZE - 1 - serialQueued();
+}
+
+void HardwareSerial::flush(void)
+{
+  if (serialTxEnd > now)
+    halAdvance(serialTxEnd - now);
+}
+
+size_t HardwareSerial::write(uint8_t data)
+{
+  HalByte sent;
+
+  halSpend(CYCLES_SERIAL_WRITE);
+  // A full buffer blocks until the oldest queued byte starts sending
+  while (serialByteTime && (serialQueued() >= SERIAL_TX_BUFFER_SIZE - 1))
+    halAdvance(serialOutput[serialOutput.size() - serialQueued()].time - serialByteTime - now + 1);
+  sent.time = (serialTxEnd > now ? serialTxEnd : now) + serialByteTime;
+  sent.data = data;
+  serialTxEnd = sent.time;
+  serialOutput.push_back(sent);
+  return 1;
+}
+
+const std::vector<HalByte> &halSerialOutput(void)
+{
+  return serialOutput;
+}
+
+void halSerialReceive(uint64_t time, uint8_t data)
+{
+  halAt(time, [data]() {
+    if (serialInput.size() < SERIAL_RX_BUFFER_SIZE - 1)
+      serialInput.push_back(data);
+  });
+}
+
+/******************************************************************************
+   USART 0. Sent bytes leave the transmit register at once and are stamped
+   with the time they would be on the line. Received bytes are delivered
+   through the receive interrupt.
+ ******************************************************************************/
+uint64_t halUartByteTime(void)
+{
+  unsigned long ubrr = (UBRR0H << 8) | UBRR0L;
+  unsigned long divisor = (UCSR0A & _BV(U2X0)) ? 8 : 16;
+
+  return 10 * 1000000000ULL * divisor * (ubrr + 1) / F_CPU;
+}
+
+HalUdr::operator uint8_t() const
+{
+  UCSR0A &= ~_BV(RXC0);
+  return uartRxData;
+}
+
+HalUdr &HalUdr::operator=(uint8_t data)
+{
+  HalByte sent;
+
+  sent.time = (uartTxEnd > now ? uartTxEnd : now) + halUartByteTime();
+  sent.data = data;
+  uartTxEnd = sent.time;
+  uartOutput.push_back(sent);
+  return *this;
+}
+
+HalUcsr0b &HalUcsr0b::operator=(uint8_t data)
+{
+  value = data;
+  if ((value & _BV(UDRIE0)) && !uartDraining && USART_UDRE_vect) {
+    uartDraining = true;
+    while (value & _BV(UDRIE0))
+      USART_UDRE_vect();
+    uartDraining = false;
+  }
+  return *this;
+}
+
+const std::vector<HalByte> &halUartOutput(void)
+{
+  return uartOutput;
+}
+
+void halUartReceive(uint64_t time, uint8_t data)
+{
+  halAt(time, [data]() {
+    if (!(UCSR0B.value & _BV(RXEN0)))
+      return;
+    uartRxData = data;
+    UCSR0A |= _BV(RXC0);
+    if ((UCSR0B.value & _BV(RXCIE0)) && USART_RX_vect)
+      USART_RX_vect();
+  });
+}
+
+/******************************************************************************
+   Print and String
+ ******************************************************************************/
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t count = 0;
+
+  while (size--)
+    count += write(*buffer++);
+  return count;
+}
+
+size_t Print::print(const __FlashStringHelper *str)
+{
+  return write((const char *)str);
+}
+
+size_t Print::print(const String &str)
+{
+  return write(str.c_str());
+}
+
+size_t Print::print(const char str[])
+{
+  return write(str);
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(int value, int base)
+{
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base)
+{
+  char buffer[34];
+
+  if (base == DEC)
+    return write(ltoa(value, buffer, base));
+  return write(ultoa(value, buffer, base));
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  char buffer[34];
+
+  return write(ultoa(value, buffer, base));
+}
+
+size_t Print::println(void)
+{
+  return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper *str)
+{
+  return print(str) + println();
+}
+
+size_t Print::println(const String &str)
+{
+  return print(str) + println();
+}
+
+size_t Print::println(const char str[])
+{
+  return print(str) + println();
+}
+
+size_t Print::println(char c)
+{
+  return print(c) + println();
+}
+
+size_t Print::println(unsigned char value, int base)
+{
+  return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base)
+{
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base)
+{
+  return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base)
+{
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base)
+{
+  return print(value, base) + println();
+}
+
+String::String(const char *str)
+{
+  strncpy(buffer, str, sizeof(buffer) - 1);
+  buffer[sizeof(buffer) - 1] = 0;
+}
+
+String::String(unsigned char value, unsigned char base)
+{
+  ultoa(value, buffer, base);
+}
+
+String::String(int value, unsigned char base)
+{
+  ltoa(value, buffer, base);
+}
+
+String::String(unsigned int value, unsigned char base)
+{
+  ultoa(value, buffer, base);
+}
+
+String::String(long value, unsigned char base)
+{
+  ltoa(value, buffer, base);
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+  ultoa(value, buffer, base);
+}
+
+/******************************************************************************
+   avr-libc number conversions. int is 16 bits and long is 32 bits on the
+   AVR, so the values are cut to those sizes as they would be there.
+ ******************************************************************************/
+char *itoa(int value, char *string, int radix)
+{
+  int16_t v = value;
+
+  if ((radix == 10) && (v < 0))
+    return formatNumber(-(int32_t)v, true, string, radix);
+  return formatNumber((uint16_t)v, false, string, radix);
+}
+
+char *utoa(unsigned int value, char *string, int radix)
+{
+  return formatNumber((uint16_t)value, false, string, radix);
+}
+
+char *ltoa(long value, char *string, int radix)
+{
+  int32_t v = value;
+
+  if ((radix == 10) && (v < 0))
+    return formatNumber(-(int64_t)v, true, string, radix);
+  return formatNumber((uint32_t)v, false, string, radix);
+}
+
+char *ultoa(unsigned long value, char *string, int radix)
+{
+  return formatNumber((uint32_t)value, false, string, radix);
+}
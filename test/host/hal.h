@@ -0,0 +1,99 @@
+/*****************************************************************************
+   File: hal.h
+
+   Author: Kjell Kernen
+
+   Hardware model behind the Arduino shim of the host build. Time is virtual
+   and only moves when the firmware calls into the Arduino core, each call
+   costing roughly what it costs on the Atmega 328 at F_CPU. The time spent in
+   firmware code between calls is not modelled. Events scheduled with halAt
+   run as interrupts when the firmware calls into the core with interrupts
+   enabled, which makes busy-wait loops of the firmware terminate.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef HAL_H
+#define HAL_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+#define HAL_NS_PER_US 1000ULL
+#define HAL_NS_PER_MS 1000000ULL
+
+/* Thrown by the core when the virtual time passes the deadline */
+struct HalDeadline {};
+
+/* A byte on a serial line, time is when its stop bit has been sent */
+struct HalByte
+{
+  uint64_t time;
+  uint8_t data;
+};
+
+/* A device on the SPI bus. select and deselect follow its ~CS pin */
+class SpiDevice
+{
+  public:
+    virtual ~SpiDevice() {}
+    virtual void select(void) {}
+    virtual void deselect(void) {}
+    virtual uint8_t transfer(uint8_t data) = 0;
+};
+
+/* Time */
+uint64_t halNow(void);                                  // ns since start
+void halAdvance(uint64_t ns);                           // Runs due events
+void halSpend(unsigned long cycles);                    // CPU cycles at F_CPU
+void halAt(uint64_t time, std::function<void(void)> event);
+void halSetDeadline(uint64_t time);                     // 0 = no deadline
+
+/* Pins */
+void halSetPin(uint8_t pin, uint8_t level);             // Drives an input
+int halPinOutput(uint8_t pin);                          // Level of an output
+void halOnPinWrite(std::function<void(uint8_t pin, uint8_t level)> listener);
+void halSetAnalog(uint8_t pin, std::function<int(void)> source);
+int halAnalogOutput(uint8_t pin);                       // Last analogWrite
+void halPress(uint8_t pin, uint64_t time, uint64_t hold);  // Button to ground
+
+/* SPI */
+void halAttachSpi(uint8_t csPin, SpiDevice *device);
+unsigned long halSpiTransactions(void);                 // SPI.beginTransaction calls
+
+/* Heap, malloc, calloc and realloc calls since start. The AVR firmware
+   should not use the heap. */
+unsigned long halHeapAllocations(void);
+
+/* EEPROM, erased (0xFF) at start */
+uint8_t *halEeprom(void);
+unsigned long halEepromWrites(void);
+
+/* Serial, the Arduino Serial object */
+const std::vector<HalByte> &halSerialOutput(void);
+void halSerialReceive(uint64_t time, uint8_t data);
+
+/* USART 0 driven through its registers, as by the MinimOSD uart */
+const std::vector<HalByte> &halUartOutput(void);
+void halUartReceive(uint64_t time, uint8_t data);
+uint64_t halUartByteTime(void);                         // ns per byte
+
+#endif /* HAL_H */
@@ -0,0 +1,323 @@
+/*****************************************************************************
+   File: max7456model.cpp
+
+   Author: Kjell Kernen
+
+   Model of the MAX7456 OSD circuit, see max7456model.h.
+   Display memory writes follow the sequence of the max7456 library: each
+   character is preceded by the DMDI address, also in auto-increment mode,
+   and a 0xFF character ends auto-increment mode.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "max7456model.h"
+#include <string.h>
+
+#define REG_VM0       0x00
+#define REG_VM1       0x01
+#define REG_DMM       0x04
+#define REG_DMAH      0x05
+#define REG_DMAL      0x06
+#define REG_DMDI      0x07
+#define REG_CMM       0x08
+#define REG_CMAH      0x09
+#define REG_CMAL      0x0A
+#define REG_CMDI      0x0B
+#define REG_OSDBL     0x6C
+#define REG_STAT      0x20    // Read addresses without bit 7
+#define REG_DMDO      0x30
+#define REG_CMDO      0x40
+
+#define STAT_RESET    0x40
+#define VM0_RESET     0x02
+#define VM0_PAL       0x40
+#define DMM_AUTO_INC  0x01
+#define DMM_CLEAR     0x04
+#define DMM_8_BIT     0x40
+#define DMAH_ATTR     0x02
+
+#define POWER_UP_NS       (50 * HAL_NS_PER_MS)    // Power-on reset, not in the data sheet
+#define RESET_NS          (100 * HAL_NS_PER_US)   // Software reset
+#define CLEAR_NS          (20 * HAL_NS_PER_US)    // Display memory clear
+#define NVM_WRITE_NS      (12 * HAL_NS_PER_MS)    // Character memory write
+#define NTSC_FIELD_NS     16683333ULL
+#define PAL_FIELD_NS      (20 * HAL_NS_PER_MS)
+#define VSYNC_LOW_NS      (3 * 64 * HAL_NS_PER_US)  // ~VSYNC is low for 3 lines
+
+/* Register values after reset, by write address */
+static const uint8_t registerDefaults[0x20] = {
+  0x00, 0x47, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01
+};
+
+Max7456Model::Max7456Model(uint8_t csPin, uint8_t vsyncPin)
+  : vsyncPin(vsyncPin), inputVideo(MODEL_VIDEO_NTSC), powerUpDone(0), resetDone(0), clearDone(0),
+    nvmDone(0), selected(false), address(-1), selects(0), transfers(0),
+    displayWriteCount(0), clearCount(0), nvmWriteCount(0)
+{
+  memset(registers, 0, sizeof(registers));
+  memset(nvmData, 0x55, sizeof(nvmData));     // Blank, transparent characters
+  reset();
+  registers[REG_OSDBL] = 0x1F;      // Bits 0-3 are set in the factory
+  halAttachSpi(csPin, this);
+  if (vsyncPin)
+    field();
+}
+
+void Max7456Model::powerUp(void)
+{
+  memset(registers, 0, sizeof(registers));
+  reset();
+  registers[REG_OSDBL] = 0x1F;
+  powerUpDone = halNow() + POWER_UP_NS;
+}
+
+void Max7456Model::setInputVideo(uint8_t format)
+{
+  inputVideo = format;
+}
+
+unsigned int Max7456Model::visibleLines(void) const
+{
+  return (registers[REG_VM0] & VM0_PAL) ? 16 : 13;
+}
+
+void Max7456Model::reset(void)
+{
+  uint8_t osdbl = registers[REG_OSDBL];
+
+  memset(registers, 0, sizeof(registers));
+  memcpy(registers, registerDefaults, sizeof(registerDefaults));
+  registers[REG_OSDBL] = osdbl;
+  memset(displayChars, 0, sizeof(displayChars));
+  memset(displayAttrs, 0, sizeof(displayAttrs));
+  memset(shadow, 0, sizeof(shadow));
+  displayAddress = 0;
+}
+
+/* Drives ~VSYNC at the start of each field of the output video format */
+void Max7456Model::field(void)
+{
+  uint8_t pin = vsyncPin;
+
+  halSetPin(pin, LOW);
+  halAt(halNow() + VSYNC_LOW_NS, [pin]() { halSetPin(pin, HIGH); });
+  halAt(halNow() + ((registers[REG_VM0] & VM0_PAL) ? PAL_FIELD_NS : NTSC_FIELD_NS), [this]() { field(); });
+}
+
+void Max7456Model::select(void)
+{
+  selected = true;
+  address = -1;
+  selects++;
+}
+
+void Max7456Model::deselect(void)
+{
+  selected = false;
+  address = -1;
+}
+
+uint8_t Max7456Model::transfer(uint8_t data)
+{
+  uint8_t result = 0;
+
+  transfers++;
+  if (address < 0)
+    address = data;
+  else {
+    if (address & 0x80)
+      result = read(address & 0x7F);
+    else
+      write(address, data);
+    address = -1;
+  }
+  return result;
+}
+
+uint8_t Max7456Model::read(uint8_t reg)
+{
+  uint64_t now = halNow();
+  uint8_t value;
+
+  switch (reg) {
+    case REG_VM0:
+      return registers[REG_VM0] | (now < resetDone ? VM0_RESET : 0);
+    case REG_DMM:
+      return registers[REG_DMM] | (now < clearDone ? DMM_CLEAR : 0);
+    case REG_STAT:
+      value = 0x18;                 // ~HSYNC and ~VSYNC inactive
+      if (inputVideo == MODEL_VIDEO_PAL)
+        value |= 0x01;
+      else if (inputVideo == MODEL_VIDEO_NTSC)
+        value |= 0x02;
+      else
+        value |= 0x04;
+      if (now < nvmDone)
+        value |= 0x20;
+      if (now < powerUpDone)
+        value |= STAT_RESET;
+      return value;
+    case REG_DMDO:
+      return (registers[REG_DMAH] & DMAH_ATTR) ? displayAttrs[displayAddress] : displayChars[displayAddress];
+    case REG_CMDO:
+      return shadow[registers[REG_CMAL] % MODEL_CHAR_BYTES];
+    default:
+      return registers[reg];
+  }
+}
+
+void Max7456Model::write(uint8_t reg, uint8_t data)
+{
+  uint64_t now = halNow();
+
+  // Writes while a reset or clear is running are lost on the real circuit
+  if ((now < powerUpDone) || (now < resetDone) || ((now < clearDone) && (reg >= REG_DMM) && (reg <= REG_DMDI)))
+    return;
+  if ((now < nvmDone) && (reg >= REG_CMM) && (reg <= REG_CMDI))
+    return;
+
+  switch (reg) {
+    case REG_VM0:
+      if (data & VM0_RESET) {
+        reset();
+        resetDone = now + RESET_NS;
+        clearCount++;
+        return;
+      }
+      registers[REG_VM0] = data;
+      return;
+    case REG_DMM:
+      if (data & DMM_CLEAR) {
+        memset(displayChars, 0, sizeof(displayChars));
+        memset(displayAttrs, 0, sizeof(displayAttrs));
+        clearDone = now + CLEAR_NS;
+        clearCount++;
+        data &= ~(DMM_CLEAR | DMM_AUTO_INC);
+      }
+      registers[REG_DMM] = data;
+      return;
+    case REG_DMAH:
+    case REG_DMAL:
+      registers[reg] = data;
+      displayAddress = (((registers[REG_DMAH] & 1) << 8) | registers[REG_DMAL]) % MODEL_CELLS;
+      return;
+    case REG_DMDI:
+      writeDisplay(data);
+      return;
+    case REG_CMM:
+      if ((data & 0xF0) == 0xA0) {
+        memcpy(nvmData + registers[REG_CMAH] * MODEL_CHAR_BYTES, shadow, MODEL_CHAR_BYTES);
+        nvmDone = now + NVM_WRITE_NS;
+        nvmWriteCount++;
+      }
+      else if ((data & 0xF0) == 0x50)
+        memcpy(shadow, nvmData + registers[REG_CMAH] * MODEL_CHAR_BYTES, MODEL_CHAR_BYTES);
+      registers[REG_CMM] = data;
+      return;
+    case REG_CMDI:
+      shadow[registers[REG_CMAL] % MODEL_CHAR_BYTES] = data;
+      return;
+    default:
+      registers[reg] = data;
+      return;
+  }
+}
+
+void Max7456Model::writeDisplay(uint8_t data)
+{
+  uint8_t dmm = registers[REG_DMM];
+
+  if (dmm & DMM_AUTO_INC) {
+    if (data == 0xFF) {             // Escape character ends auto-increment
+      registers[REG_DMM] &= ~DMM_AUTO_INC;
+      return;
+    }
+  }
+  if ((dmm & DMM_8_BIT) && (registers[REG_DMAH] & DMAH_ATTR))
+    displayAttrs[displayAddress] = data & 0x07;
+  else {
+    displayChars[displayAddress] = data;
+    if (!(dmm & DMM_8_BIT))
+      displayAttrs[displayAddress] = (dmm >> 3) & 0x07;
+  }
+  displayWriteCount++;
+  if (dmm & DMM_AUTO_INC)
+    displayAddress = (displayAddress + 1) % MODEL_CELLS;
+}
+
+std::string Max7456Model::text(void) const
+{
+  std::string result;
+  std::string attrs;
+  unsigned int line, column, address;
+  uint8_t c, a;
+  bool marked;
+
+  for (line = 0; line < visibleLines(); line++) {
+    result += '|';
+    attrs = "|";
+    marked = false;
+    for (column = 0; column < MODEL_COLUMNS; column++) {
+      address = line * MODEL_COLUMNS + column;
+      c = displayChars[address];
+      a = displayAttrs[address] & (MODEL_ATTR_BLINK | MODEL_ATTR_INVERSE);
+      if ((c >= 0xA0) && (c < 0xFF))
+        c -= 0x80;
+      result += (c == 0) ? ' ' : (((c >= 0x20) && (c < 0x7F)) ? (char)c : '#');
+      attrs += (a == (MODEL_ATTR_BLINK | MODEL_ATTR_INVERSE)) ? '*' :
+               (a == MODEL_ATTR_BLINK) ? 'b' : (a == MODEL_ATTR_INVERSE) ? 'i' : ' ';
+      marked |= (a != 0);
+    }
+    result += "|\n";
+    if (marked)
+      result += attrs + "|\n";
+  }
+  return result;
+}
+
+std::string Max7456Model::image(void) const
+{
+  unsigned int width = MODEL_COLUMNS * MODEL_CHAR_WIDTH;
+  unsigned int height = visibleLines() * MODEL_CHAR_HEIGHT;
+  std::string result = "P5\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+  unsigned int x, y, address;
+  uint8_t pixel, a;
+  const uint8_t *glyph;
+
+  for (y = 0; y < height; y++) {
+    for (x = 0; x < width; x++) {
+      address = (y / MODEL_CHAR_HEIGHT) * MODEL_COLUMNS + x / MODEL_CHAR_WIDTH;
+      glyph = nvm(displayChars[address]) + (y % MODEL_CHAR_HEIGHT) * 3;
+      pixel = (glyph[(x % MODEL_CHAR_WIDTH) / 4] >> (6 - 2 * (x % 4))) & 3;
+      a = displayAttrs[address];
+      if (pixel & 1)                  // Transparent
+        result += (char)((a & MODEL_ATTR_LBC) ? 64 : 128);
+      else if (!(pixel & 2) != !(a & MODEL_ATTR_INVERSE))
+        result += (char)255;          // White, or inverted black
+      else
+        result += (char)0;
+    }
+  }
+  return result;
+}
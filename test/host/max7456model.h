@@ -0,0 +1,126 @@
+/*****************************************************************************
+   File: max7456model.h
+
+   Author: Kjell Kernen
+
+   Model of the MAX7456 OSD circuit on the SPI bus of the host build. The
+   registers, display memory and character memory (NVM) used by the max7456
+   library are modelled, with the busy times of the data sheet for display
+   memory clears, NVM writes and software resets. The model also drives the
+   ~VSYNC pin at the field rate of the selected video format.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef MAX7456MODEL_H
+#define MAX7456MODEL_H
+
+#include <string>
+#include "hal.h"
+
+#define MODEL_COLUMNS         30
+#define MODEL_LINES           16
+#define MODEL_CELLS           (MODEL_COLUMNS * MODEL_LINES)
+#define MODEL_CHAR_BYTES      64    // NVM bytes per character, 54 are used
+#define MODEL_CHAR_WIDTH      12
+#define MODEL_CHAR_HEIGHT     18
+
+#define MODEL_VIDEO_NTSC      0     // Same values as the MinimOSD VIDEO_xxx
+#define MODEL_VIDEO_PAL       1
+#define MODEL_VIDEO_NONE      2
+
+#define MODEL_ATTR_LBC        0x04  // Display memory attribute bits
+#define MODEL_ATTR_BLINK      0x02
+#define MODEL_ATTR_INVERSE    0x01
+
+class Max7456Model : public SpiDevice
+{
+  public:
+    /* Attaches the model to the SPI bus. vsyncPin is driven if not 0 */
+    Max7456Model(uint8_t csPin, uint8_t vsyncPin);
+
+    /* Power cycle. The power-on reset runs again, the character memory
+       is kept. The model starts powered up at construction. */
+    void powerUp(void);
+
+    /* Incoming video, MODEL_VIDEO_xxx. NONE means loss of sync */
+    void setInputVideo(uint8_t format);
+
+    /* Display memory */
+    uint8_t character(unsigned int address) const { return displayChars[address % MODEL_CELLS]; }
+    uint8_t attribute(unsigned int address) const { return displayAttrs[address % MODEL_CELLS]; }
+    unsigned int visibleLines(void) const;
+
+    /* Character memory, 64 bytes per character */
+    const uint8_t *nvm(uint8_t c) const { return nvmData + c * MODEL_CHAR_BYTES; }
+    unsigned long nvmWrites(void) const { return nvmWriteCount; }
+
+    /* Register value as last written, by write address */
+    uint8_t reg(uint8_t address) const { return registers[address & 0x7F]; }
+
+    /* Traffic since start */
+    unsigned long csCycles(void) const { return selects; }
+    unsigned long bytes(void) const { return transfers; }
+    unsigned long displayWrites(void) const { return displayWriteCount; }
+    unsigned long clears(void) const { return clearCount; }
+
+    /* Visible lines as text, one row per line between | characters. Letters
+       and digits are shown as they are, filled characters without fill,
+       empty cells as spaces and other symbols as #. Rows with blinking or
+       inverted cells are followed by an attribute row: b, i or * for both. */
+    std::string text(void) const;
+
+    /* Visible lines as a binary PGM image drawn with the character memory.
+       Transparent pixels are gray. */
+    std::string image(void) const;
+
+    virtual void select(void);
+    virtual void deselect(void);
+    virtual uint8_t transfer(uint8_t data);
+
+  private:
+    void reset(void);
+    void write(uint8_t address, uint8_t data);
+    uint8_t read(uint8_t address);
+    void writeDisplay(uint8_t data);
+    void field(void);
+
+    uint8_t vsyncPin;
+    uint8_t inputVideo;
+    uint8_t registers[0x80];
+    uint8_t displayChars[MODEL_CELLS];
+    uint8_t displayAttrs[MODEL_CELLS];
+    unsigned int displayAddress;
+    uint8_t nvmData[256 * MODEL_CHAR_BYTES];
+    uint8_t shadow[MODEL_CHAR_BYTES];     // Character memory shadow RAM
+    uint64_t powerUpDone;                 // End of the power-on reset
+    uint64_t resetDone;                   // End of a software reset
+    uint64_t clearDone;                   // End of a display memory clear
+    uint64_t nvmDone;                     // End of an NVM write
+    bool selected;
+    int address;                          // Register of the current access, -1 = none
+    unsigned long selects;
+    unsigned long transfers;
+    unsigned long displayWriteCount;
+    unsigned long clearCount;
+    unsigned long nvmWriteCount;
+};
+
+#endif /* MAX7456MODEL_H */
@@ -0,0 +1,121 @@
+/*****************************************************************************
+   File: rfscene.cpp
+
+   Author: Kjell Kernen
+
+   Model of the 5.8 GHz band, see rfscene.h. The RSSI output of the RX5808 is
+   close to linear in dB: RSSI_ADC_PER_DB ADC steps per dB above the noise
+   floor, limited by the ADC range.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "rfscene.h"
+#include <math.h>
+
+#define RSSI_ADC_PER_DB     8.0
+#define TOP_OF_BAND         5945.0
+
+RfScene::RfScene(const Rx5808 &receiver)
+  : receiver(receiver), noiseFloor(140), noiseTilt(0), noiseJitter(0), bleed(30), bleedRange(60),
+    tau(6), tunes(0), settleFrom(140), lastFrequency(TOP_OF_BAND), lastTuneTime(0), random(2463534242UL)
+{
+}
+
+void RfScene::add(const Transmitter &transmitter)
+{
+  sources.push_back(transmitter);
+}
+
+void RfScene::setNoise(double floor, double tilt, double jitter)
+{
+  noiseFloor = floor;
+  noiseTilt = tilt;
+  noiseJitter = jitter;
+}
+
+void RfScene::setBleed(double attenuation, double range)
+{
+  bleed = attenuation;
+  bleedRange = range;
+}
+
+void RfScene::setSettling(double tauMs)
+{
+  tau = tauMs;
+}
+
+double RfScene::frequencyOf(const Transmitter &transmitter, uint64_t time) const
+{
+  return transmitter.frequency + transmitter.drift * time / 1e9;
+}
+
+/* Receiver filter response in dB: 3 dB at the edge of the main lobe, then
+   falling by 25 dB per half bandwidth, but never below the bleed level
+   within the bleed range */
+double RfScene::attenuation(double offset, double bandwidth) const
+{
+  double x = fabs(offset) / (bandwidth / 2);
+  double result = (x <= 1) ? 3 * x * x : 3 + 25 * (x - 1);
+
+  if ((fabs(offset) <= bleedRange) && (result > bleed))
+    result = bleed;
+  return result;
+}
+
+double RfScene::settledRssi(double frequency, uint64_t time) const
+{
+  double power = 1;         // The noise floor
+  double rssi;
+
+  for (size_t i = 0; i < sources.size(); i++)
+    power += pow(10, (sources[i].power -
+                      attenuation(frequency - frequencyOf(sources[i], time), sources[i].bandwidth)) / 10);
+  rssi = noiseFloor + noiseTilt * (TOP_OF_BAND - frequency) / 100 + RSSI_ADC_PER_DB * 10 * log10(power);
+  return rssi > 1023 ? 1023 : rssi;
+}
+
+/* Output for the last tune at a time */
+double RfScene::output(uint64_t time) const
+{
+  double settled = settledRssi(lastFrequency, time);
+
+  return settled + (settleFrom - settled) * exp(-((time - lastTuneTime) / 1e6) / tau);
+}
+
+int RfScene::rssi(void)
+{
+  double result;
+
+  // The output moves from where it was at the tune towards the new level
+  if (receiver.tunes() != tunes) {
+    settleFrom = tunes ? output(receiver.tuneTime()) : noiseFloor;
+    tunes = receiver.tunes();
+    lastFrequency = receiver.frequency();
+    lastTuneTime = receiver.tuneTime();
+  }
+  result = output(halNow());
+
+  random ^= random << 13;
+  random ^= random >> 17;
+  random ^= random << 5;
+  result += noiseJitter * ((random % 2001) / 1000.0 - 1);
+  return result < 0 ? 0 : (result > 1023 ? 1023 : (int)(result + 0.5));
+}
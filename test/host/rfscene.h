@@ -0,0 +1,96 @@
+/*****************************************************************************
+   File: rfscene.h
+
+   Author: Kjell Kernen
+
+   Model of the 5.8 GHz band as seen by the RSSI output of an RX5808. A scene
+   holds transmitters and a noise floor. The RSSI is computed from the
+   frequency the receiver is tuned to, the receiver filter response with
+   bleed from adjacent channels, and the settling of the RSSI output after
+   each tune.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef RFSCENE_H
+#define RFSCENE_H
+
+#include <vector>
+#include "hal.h"
+#include "rx5808.h"
+
+struct Transmitter
+{
+  double frequency;     // MHz at time 0
+  double power;         // dB above the noise floor at the receiver
+  double bandwidth;     // MHz, 3 dB width of the video signal
+  double drift;         // MHz per second
+};
+
+class RfScene
+{
+  public:
+    /* The scene follows the tunes of the receiver */
+    RfScene(const Rx5808 &receiver);
+
+    void add(const Transmitter &transmitter);
+
+    /* RSSI of the noise floor at the top of the band, growing by tilt for
+       each 100 MHz further down, with uniform noise of +- jitter */
+    void setNoise(double floor, double tilt, double jitter);
+
+    /* Attenuation of signals outside the main lobe, and how far away the
+       bleed reaches */
+    void setBleed(double attenuation, double range);
+
+    /* Time constant of the RSSI output after a tune */
+    void setSettling(double tauMs);
+
+    /* Transmitter frequency at a time */
+    double frequencyOf(const Transmitter &transmitter, uint64_t time) const;
+
+    const std::vector<Transmitter> &transmitters(void) const { return sources; }
+
+    /* Settled RSSI for a tuned frequency, without noise */
+    double settledRssi(double frequency, uint64_t time) const;
+
+    /* RSSI output now, as read by analogRead */
+    int rssi(void);
+
+  private:
+    double attenuation(double offset, double bandwidth) const;
+    double output(uint64_t time) const;
+
+    const Rx5808 &receiver;
+    std::vector<Transmitter> sources;
+    double noiseFloor;
+    double noiseTilt;
+    double noiseJitter;
+    double bleed;
+    double bleedRange;
+    double tau;
+    unsigned long tunes;        // Receiver tunes seen
+    double settleFrom;          // RSSI output at the last tune
+    double lastFrequency;       // Tuned at the last tune
+    uint64_t lastTuneTime;
+    uint32_t random;
+};
+
+#endif /* RFSCENE_H */
@@ -0,0 +1,65 @@
+/*****************************************************************************
+   File: rx5808.cpp
+
+   Author: Kjell Kernen
+
+   Model of the RX5808 receiver module, see rx5808.h
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include "rx5808.h"
+
+/* Register B write: 4 address bits, the write bit and 20 data bits */
+#define RTC6715_FRAME_BITS    25
+#define RTC6715_SYNTH_B       0x01
+#define RTC6715_WRITE         0x10
+
+Rx5808::Rx5808(uint8_t clockPin, uint8_t selectPin, uint8_t dataPin) :
+  clockPin(clockPin), selectPin(selectPin), dataPin(dataPin), receiving(false),
+  bitCount(0), bits(0), tunedFrequency(0), lastTuneTime(0), tuneCount(0)
+{
+  halOnPinWrite([this](uint8_t pin, uint8_t level) { pinWritten(pin, level); });
+}
+
+void Rx5808::pinWritten(uint8_t pin, uint8_t level)
+{
+  unsigned int data;
+
+  if (pin == selectPin) {
+    // A frame starts with a falling and ends with a rising slave select
+    if ((level == HIGH) && receiving && (bitCount == RTC6715_FRAME_BITS) &&
+        ((bits & 0x1F) == (RTC6715_WRITE | RTC6715_SYNTH_B))) {
+      data = bits >> 5;
+      tunedFrequency = 2 * ((data >> 7) * 32 + (data & 0x7F)) + 479;
+      lastTuneTime = halNow();
+      tuneCount++;
+    }
+    receiving = (level == LOW);
+    bitCount = 0;
+    bits = 0;
+  }
+  else if ((pin == clockPin) && (level == HIGH) && receiving && (bitCount < 32)) {
+    // Bits are sampled on the rising clock edge, LSB first
+    if (halPinOutput(dataPin))
+      bits |= 1UL << bitCount;
+    bitCount++;
+  }
+}
@@ -0,0 +1,63 @@
+/*****************************************************************************
+   File: rx5808.h
+
+   Author: Kjell Kernen
+
+   Model of the RX5808 receiver module. The synthesizer register writes that
+   rtc6715.cpp bit bangs on three pins are decoded to the tuned frequency.
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#ifndef RX5808_H
+#define RX5808_H
+
+#include "hal.h"
+
+class Rx5808
+{
+  public:
+    /* Listens to the pins, the pin numbers are those given to rtc6715 */
+    Rx5808(uint8_t clockPin, uint8_t selectPin, uint8_t dataPin);
+
+    /* Tuned frequency in MHz, 0 before the first tune */
+    unsigned int frequency(void) const { return tunedFrequency; }
+
+    /* Time of the last synthesizer write */
+    uint64_t tuneTime(void) const { return lastTuneTime; }
+
+    /* Number of synthesizer writes */
+    unsigned long tunes(void) const { return tuneCount; }
+
+  private:
+    void pinWritten(uint8_t pin, uint8_t level);
+
+    uint8_t clockPin;
+    uint8_t selectPin;
+    uint8_t dataPin;
+    bool receiving;
+    uint8_t bitCount;
+    uint32_t bits;
+    unsigned int tunedFrequency;
+    uint64_t lastTuneTime;
+    unsigned long tuneCount;
+};
+
+#endif /* RX5808_H */
@@ -0,0 +1,821 @@
+/*****************************************************************************
+   File: minimosd_host.cpp
+
+   Author: Kjell Kernen
+
+   Host build of MinimOSD for CYCLOP. The sketch is compiled as it is
+   against the Arduino shim, followed by its unit tests.
+   Usage: minimosd_host test [name prefix]
+          minimosd_host render [--lost-sync] <recording> <text file> [<pgm file>]
+          minimosd_host bench <recording>...
+
+  Copyright (c) 2017 Kjell Kernen (Dvogonen)
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+ *****************************************************************************/
+#include <Arduino.h>
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <util/crc16.h>
+#include "host/hal.h"
+#include "host/check.h"
+#include "host/max7456model.h"
+
+#include "../src/minimosd_for_cyclop/minimosd_for_cyclop.ino"
+
+/******************************************************************************
+   Helpers
+ ******************************************************************************/
+/* Feeds bytes of the display protocol to a parser */
+static void feed(ParserState &state, const std::vector<uint8_t> &bytes)
+{
+  for (size_t i = 0; i < bytes.size(); i++)
+    parseByte(state, bytes[i]);
+}
+
+/* Text of a back buffer line, empty cells as spaces */
+static std::string line(byte y)
+{
+  std::string text;
+
+  for (int x = 0; x < SCREEN_COLUMNS; x++)
+    text += screenChars[y * SCREEN_COLUMNS + x] ? (char)screenChars[y * SCREEN_COLUMNS + x] : ' ';
+  return text;
+}
+
+/* Template image as built by CYCLOP++: count, offsets and templates */
+static std::vector<uint8_t> templateImage(const std::vector<std::vector<uint8_t> > &templates)
+{
+  std::vector<uint8_t> image(1, (uint8_t)templates.size());
+  unsigned int offset = 1 + 2 * (templates.size() + 1);
+
+  for (size_t i = 0; i <= templates.size(); i++) {
+    image.push_back(offset & 0xFF);
+    image.push_back(offset >> 8);
+    if (i < templates.size())
+      offset += templates[i].size();
+  }
+  for (size_t i = 0; i < templates.size(); i++)
+    image.insert(image.end(), templates[i].begin(), templates[i].end());
+  return image;
+}
+
+/* LOAD_TEMPLATES command carrying an image and its hash */
+static std::vector<uint8_t> loadTemplates(const std::vector<uint8_t> &image, unsigned int hash)
+{
+  const uint8_t header[] = { CMD_CMD, CMD_LOAD_TEMPLATES, (uint8_t)(hash >> 14), (uint8_t)((hash >> 7) & 0x7F),
+                             (uint8_t)(hash & 0x7F), (uint8_t)(image.size() >> 7), (uint8_t)(image.size() & 0x7F) };
+  std::vector<uint8_t> bytes;
+
+  bytes.reserve(sizeof(header) + image.size());
+  for (size_t i = 0; i < sizeof(header); i++)
+    bytes.push_back(header[i]);
+  for (size_t i = 0; i < image.size(); i++)
+    bytes.push_back(image[i]);
+  return bytes;
+}
+
+static unsigned int crcOf(const std::vector<uint8_t> &image)
+{
+  unsigned int crc = 0xFFFF;
+
+  for (size_t i = 0; i < image.size(); i++)
+    crc = _crc_ccitt_update(crc, image[i]);
+  return crc;
+}
+
+/* First cell where the display memory differs from the back buffer, cells
+   under the loss of sync warning excepted
+   return : the cell address, or -1 if the display memory is equal */
+static int displayMismatch(const Max7456Model &model)
+{
+  byte attr;
+
+  for (unsigned int address = 0; address < SCREEN_CELLS; address++) {
+    if ((address >= overlayStart) && (address < overlayEnd))
+      continue;
+    attr = ((cellAttr(address) & ATTR_BLINK) ? MODEL_ATTR_BLINK : 0) |
+           ((cellAttr(address) & ATTR_INVERSE) ? MODEL_ATTR_INVERSE : 0);
+    if ((model.character(address) != screenChars[address]) ||
+        ((model.attribute(address) & (MODEL_ATTR_BLINK | MODEL_ATTR_INVERSE)) != attr))
+      return address;
+  }
+  return -1;
+}
+
+/******************************************************************************
+   Parser
+ ******************************************************************************/
+TEST(parser_text)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  feed(state, { CMD_CMD, CMD_SET_X, 3, CMD_CMD, CMD_SET_Y, 2, 'h', 'i' });
+  CHECK(line(2) == "   hi                         ");
+  CHECK_EQUAL(5, curX);
+  feed(state, { CMD_CMD, CMD_NEWLINE, 'x' });
+  CHECK_EQUAL('x', screenChars[3 * SCREEN_COLUMNS]);
+}
+
+TEST(parser_fill_and_attributes)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  feed(state, { CMD_CMD, CMD_ENABLE_FILL, CMD_CMD, CMD_ENABLE_INVERSE, 'A', 0x0D,
+                CMD_CMD, CMD_DISABLE_FILL, CMD_CMD, CMD_DISABLE_INVERSE, 'A' });
+  CHECK_EQUAL('A' + 0x80, screenChars[0]);
+  CHECK_EQUAL(0x0D, screenChars[1]);
+  CHECK_EQUAL('A', screenChars[2]);
+  CHECK_EQUAL(ATTR_INVERSE, cellAttr(0));
+  CHECK_EQUAL(0, cellAttr(2));
+  CHECK(isDirty(0) && isDirty(2) && !isDirty(3));
+}
+
+TEST(parser_command_aborts_params)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  // A lost param byte must not turn the next command into a param
+  feed(state, { CMD_CMD, CMD_SET_Y, CMD_CMD, CMD_SET_X, 7, 'z' });
+  CHECK_EQUAL('z', screenChars[7]);
+  CHECK_EQUAL(PARSE_TEXT, state.mode);
+}
+
+TEST(parser_survey_data_skipped)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  feed(state, { CMD_CMD, CMD_SURVEY_DATA, 0, 4, CMD_CMD, CMD_CLEAR_SCREEN, 'q', 'q', 'k' });
+  CHECK_EQUAL('k', screenChars[0]);
+  CHECK(!screenClearPending);
+}
+
+/******************************************************************************
+   Info line
+ ******************************************************************************/
+TEST(info_line_right)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  // Raceband 1 (position 32), 5658 MHz, RSSI 321, 90 % battery
+  feed(state, { CMD_CMD, CMD_INFO_LINE, 32, 5658 >> 7, 5658 & 0x7F, 321 >> 7, 321 & 0x7F, 90, 0 });
+  CHECK(line(0) == std::string("            c1 \x0D" "5658 \x0C" "321\x01    ", 30));
+}
+
+TEST(info_line_left_battery_text)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+
+  feed(state, { CMD_CMD, CMD_INFO_LINE, 9, 5752 >> 7, 5752 & 0x7F, 0, 80, 50,
+                INFO_FLAG_LEFT | INFO_FLAG_BAT_TEXT });
+  CHECK(line(0) == std::string(" \x03" "50%  b2 \x0D" "5752 \x0C" "80           ", 30));
+}
+
+/******************************************************************************
+   Templates
+ ******************************************************************************/
+TEST(template_upload_and_draw)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  std::vector<uint8_t> image = templateImage({ { 'a', 'b' }, { CMD_CMD, CMD_SET_X, 2, 'c' } });
+  unsigned int hash = crcOf(image);
+
+  feed(state, loadTemplates(image, hash));
+  CHECK_EQUAL(hash, readTemplateHash());
+  CHECK_EQUAL(PARSE_TEXT, state.mode);
+  feed(state, { CMD_CMD, CMD_DRAW_TEMPLATE, 1, 10, 4, 'd' });
+  CHECK(line(4) == "            cd                ");
+  feed(state, { CMD_CMD, CMD_DRAW_TEMPLATE, 0, 0, 5 });
+  CHECK(line(5).substr(0, 2) == "ab");
+  CHECK_EQUAL(0, originX);
+}
+
+TEST(template_bad_crc)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  std::vector<uint8_t> image = templateImage({ { 'a', 'b' } });
+
+  feed(state, loadTemplates(image, crcOf(image) ^ 1));
+  CHECK_EQUAL(TEMPLATE_HASH_NONE, readTemplateHash());
+  feed(state, { CMD_CMD, CMD_DRAW_TEMPLATE, 0, 0, 0 });
+  CHECK_EQUAL(0, screenChars[0]);
+}
+
+TEST(template_same_hash_skips_eeprom)
+{
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  std::vector<uint8_t> image = templateImage({ { 'a', 'b' } });
+  unsigned long writes;
+
+  feed(state, loadTemplates(image, crcOf(image)));
+  writes = halEepromWrites();
+  feed(state, loadTemplates(image, crcOf(image)));
+  CHECK_EQUAL(writes, halEepromWrites());
+}
+
+/******************************************************************************
+   Status frames
+ ******************************************************************************/
+TEST(status_frame)
+{
+  const std::vector<HalByte> &output = halUartOutput();
+  byte check = 0;
+
+  uart.begin(57600);
+  halEeprom()[EEPROM_TEMPLATE_HASH] = 0x34;
+  halEeprom()[EEPROM_TEMPLATE_HASH + 1] = 0x92;
+  sendStatus();
+  CHECK_EQUAL(STATUS_PARAMS + 2, output.size());
+  CHECK_EQUAL(STATUS_START, output[0].data);
+  CHECK_EQUAL(STATUS_FRAME, output[1].data);
+  CHECK_EQUAL(0, output[2 + STATUS_CONSUMED_HI].data);
+  CHECK_EQUAL(0, output[2 + STATUS_CONSUMED_LO].data);
+  CHECK_EQUAL(UART_RX_BUFFER_SIZE / 8 - 1, output[2 + STATUS_BUFFER_SIZE].data);
+  CHECK_EQUAL(0x9234, (output[2 + STATUS_TEMPLATE_HI].data << 14) |
+                      (output[2 + STATUS_TEMPLATE_MID].data << 7) | output[2 + STATUS_TEMPLATE_LO].data);
+  for (int i = 1; i < STATUS_PARAMS + 1; i++)
+    check ^= output[i].data;
+  CHECK_EQUAL(check, output[STATUS_PARAMS + 1].data);
+}
+
+TEST(status_consumed_count)
+{
+  const std::vector<HalByte> &output = halUartOutput();
+
+  uart.begin(57600);
+  for (int i = 0; i < 200; i++)
+    halUartReceive(halNow() + (i + 1) * halUartByteTime(), 'a');
+  for (int i = 0; i < 201; i++) {
+    halAdvance(halUartByteTime());
+    while (uart.available())
+      uart.read();
+  }
+  sendStatus();
+  CHECK_EQUAL(0, output[2 + STATUS_OVERFLOWS_HI].data);
+  CHECK_EQUAL(0, output[2 + STATUS_OVERFLOWS_LO].data);
+  CHECK_EQUAL(200 >> 7, output[2 + STATUS_CONSUMED_HI].data);
+  CHECK_EQUAL(200 & 0x7F, output[2 + STATUS_CONSUMED_LO].data);
+}
+
+TEST(status_overflow_count)
+{
+  const std::vector<HalByte> &output = halUartOutput();
+  unsigned int overflows;
+
+  uart.begin(57600);
+  for (int i = 0; i < 400; i++)
+    halUartReceive(halNow() + (i + 1) * halUartByteTime(), 'a');
+  halAdvance(401 * halUartByteTime());
+  overflows = uart.overflows();
+  CHECK(overflows > 127);                           // Beyond a single param
+  sendStatus();
+  CHECK_EQUAL(overflows >> 7, output[2 + STATUS_OVERFLOWS_HI].data);
+  CHECK_EQUAL(overflows & 0x7F, output[2 + STATUS_OVERFLOWS_LO].data);
+}
+
+/******************************************************************************
+   Video format
+ ******************************************************************************/
+TEST(video_format_scripted_stat)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  const std::vector<HalByte> &output = halUartOutput();
+  // Input video seen in STAT at each check, and the active format after it
+  const struct { uint8_t input; byte format; } script[] = {
+    { MODEL_VIDEO_NTSC, VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_NTSC, VIDEO_NTSC },   // A flap resets the count
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_NONE, VIDEO_NTSC },   // So does a lost signal
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_NTSC },
+    { MODEL_VIDEO_PAL,  VIDEO_PAL  },   // VIDEO_SWITCH_READS in a row
+    { MODEL_VIDEO_NONE, VIDEO_PAL  },
+    { MODEL_VIDEO_NONE, VIDEO_PAL  },
+    { MODEL_VIDEO_NONE, VIDEO_PAL  },
+    { MODEL_VIDEO_NONE, VIDEO_PAL  },
+    { MODEL_VIDEO_NONE, VIDEO_PAL  },
+    { MODEL_VIDEO_NONE, VIDEO_PAL  }    // Never a switch to no video
+  };
+  unsigned int switches = 0;
+  size_t sent;
+
+  setup();
+  CHECK_EQUAL(VIDEO_NTSC, videoFormat);
+  for (size_t i = 0; i < sizeof(script) / sizeof(script[0]); i++) {
+    model.setInputVideo(script[i].input);
+    sent = output.size();
+    updateVideoFormat();
+    CHECK_EQUAL(script[i].format, videoFormat);
+    if (output.size() != sent) {
+      // A switch is reported to CYCLOP++ at once
+      switches++;
+      CHECK_EQUAL(STATUS_FRAME, output[sent + 1].data);
+      CHECK_EQUAL(script[i].format, output[sent + 2 + STATUS_VIDEO].data);
+    }
+  }
+  CHECK_EQUAL(1, switches);
+  CHECK(model.reg(0x00) & 0x40);                    // VM0: PAL output
+  CHECK_EQUAL(PAL_LINES, screenLines);
+  CHECK_EQUAL(16, model.visibleLines());
+}
+
+/******************************************************************************
+   Boot
+ ******************************************************************************/
+TEST(boot_loads_charset)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  charact glyph;
+  const byte *data = fontData;
+  int c = 0;
+
+  setup();                                          // Erased EEPROM
+  CHECK_EQUAL(256, model.nvmWrites());
+  do {
+    data = osd.decodeCharacter(fontRows, data, glyph);
+    CHECK(!memcmp(model.nvm(c), glyph, sizeof(charact)));
+  } while (++c < 256);
+}
+
+/* Reads the characters of a .mcm file, 64 bytes each of which the first 54
+   are pixels
+   return : false if the file can not be read */
+static bool readMcm(const char *path, std::vector<uint8_t> &bytes)
+{
+  char line[16];
+  FILE *file = fopen(path, "r");
+
+  if (!file) {
+    perror(path);
+    return false;
+  }
+  if (fscanf(file, "%15s", line) == 1 && !strcmp(line, "MAX7456"))
+    while (fscanf(file, "%15s", line) == 1)
+      bytes.push_back(strtoul(line, 0, 2));
+  fclose(file);
+  return bytes.size() == 256 * 64;
+}
+
+/* A pixel with the low bit set is transparent. The .mcm uses 01 and the
+   compressed font 11, so both are compared as 11 */
+static uint8_t transparentAsOnes(uint8_t pixels)
+{
+  return pixels | ((pixels & 0x55) << 1);
+}
+
+TEST(font_decodes_to_mcm)
+{
+  std::vector<uint8_t> mcm;
+  charact glyph;
+  const byte *data = fontData;
+  int mismatches = 0;
+
+  CHECK(readMcm(MCM_FILE, mcm));
+  if (mcm.size() != 256 * 64)
+    return;
+  for (int c = 0; c < 256; c++) {
+    data = osd.decodeCharacter(fontRows, data, glyph);
+    for (int i = 0; i < (int)sizeof(charact); i++)
+      if (transparentAsOnes(mcm[c * 64 + i]) != transparentAsOnes(glyph[i]))
+        mismatches++;
+  }
+  CHECK_EQUAL(0, mismatches);
+  CHECK_EQUAL(sizeof(fontData), data - fontData);
+}
+
+TEST(boot_charset_kept)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  unsigned long writes;
+
+  setup();
+  writes = model.nvmWrites();
+  CHECK(writes > 0);
+  CHECK(model.reg(0x00) & 0x08);                    // VM0: OSD enabled
+  setup();
+  CHECK_EQUAL(writes, model.nvmWrites());
+}
+
+TEST(boot_init_reports_reset)
+{
+  CHECK(!osd.init(CS_PIN));                         // No MAX7456 on the bus
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  CHECK(osd.init(CS_PIN));
+}
+
+TEST(boot_new_epoch)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  const std::vector<HalByte> &output = halUartOutput();
+
+  halEeprom()[EEPROM_BOOT_EPOCH] = 0x7E;
+  setup();
+  CHECK_EQUAL(0x7F, bootEpoch);
+  setup();
+  CHECK_EQUAL(0, bootEpoch);                        // Wraps at 128
+  halAdvance(100 * HAL_NS_PER_MS);
+  sendStatus();
+  CHECK_EQUAL(0, output[output.size() - STATUS_PARAMS + STATUS_EPOCH].data);
+}
+
+/* Time from power on to the first received character on screen, with the
+   character set already in the MAX7456 */
+static uint64_t bootToFirstCharacter(Max7456Model &model)
+{
+  uint64_t start;
+
+  setup();
+  model.powerUp();
+  start = halNow();
+  halUartReceive(start + HAL_NS_PER_MS, 'x');
+  setup();
+  while (model.character(0) != 'x')
+    loop();
+  return halNow() - start;
+}
+
+TEST(boot_to_first_character)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+
+  // The fixed delays of the old init took 200 ms alone
+  CHECK(bootToFirstCharacter(model) < 100 * HAL_NS_PER_MS);
+}
+
+TEST(commit_writes_display_memory)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  unsigned long csCycles;
+
+  setup();
+  feed(state, { CMD_CMD, CMD_SET_X, 4, CMD_CMD, CMD_SET_Y, 1, 'h', 'e', 'y',
+                CMD_CMD, CMD_ENABLE_INVERSE, 'x' });
+  csCycles = model.csCycles();
+  commitScreen();
+  CHECK_EQUAL(2, model.csCycles() - csCycles);      // One burst per attribute
+  CHECK_EQUAL('h', model.character(34));
+  CHECK_EQUAL('y', model.character(36));
+  CHECK_EQUAL('x', model.character(37));
+  CHECK_EQUAL(MODEL_ATTR_INVERSE, model.attribute(37));
+  CHECK_EQUAL(0, model.attribute(36));
+  csCycles = model.csCycles();
+  commitScreen();
+  CHECK_EQUAL(0, model.csCycles() - csCycles);      // Nothing is dirty
+}
+
+TEST(commit_clear_is_asynchronous)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  unsigned long clears;
+
+  setup();
+  feed(state, { CMD_CMD, CMD_CLEAR_SCREEN, 'a' });
+  clears = model.clears();
+  commitScreen();
+  CHECK(screenClearing);                            // Returns without waiting
+  CHECK(!osd.poll());
+  CHECK_EQUAL(1, model.clears() - clears);
+  halAdvance(HAL_NS_PER_MS);
+  CHECK(osd.poll());
+  commitScreen();
+  CHECK(!screenClearing);
+  CHECK_EQUAL('a', model.character(0));
+}
+
+TEST(commit_display_memory_matches_back_buffer)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+  std::vector<uint8_t> bytes;
+  int fields = 0;
+
+  setup();
+  // A full screen with attribute changes and cursor jumps, more cells than
+  // are written in one field
+  for (unsigned int i = 0; i < SCREEN_CELLS; i++) {
+    if (i % 7 == 0)
+      bytes.insert(bytes.end(), { CMD_CMD, (uint8_t)((i / 7) % 2 ? CMD_ENABLE_INVERSE : CMD_DISABLE_INVERSE) });
+    if (i % 11 == 0)
+      bytes.insert(bytes.end(), { CMD_CMD, (uint8_t)((i / 11) % 3 ? CMD_DISABLE_BLINK : CMD_ENABLE_BLINK) });
+    if (i % 53 == 0)
+      bytes.insert(bytes.end(), { CMD_CMD, CMD_SET_X, (uint8_t)(i % SCREEN_COLUMNS),
+                                  CMD_CMD, CMD_SET_Y, (uint8_t)(i / SCREEN_COLUMNS) });
+    bytes.push_back(0x20 + (i * 13) % 0x5F);
+  }
+  feed(state, { CMD_CMD, CMD_CLEAR_SCREEN });
+  feed(state, bytes);
+  do {
+    halAdvance(HAL_NS_PER_MS);
+    commitScreen();
+    fields++;
+  } while (cellsPerField || screenClearing);
+  CHECK(fields > 2);
+  CHECK_EQUAL(-1, displayMismatch(model));
+
+  // Overwrites of a part of the screen
+  feed(state, { CMD_CMD, CMD_SET_X, 3, CMD_CMD, CMD_SET_Y, 5, CMD_CMD, CMD_ENABLE_INVERSE, 'a', 'b',
+                CMD_CMD, CMD_DISABLE_INVERSE, 'c' });
+  commitScreen();
+  CHECK_EQUAL(-1, displayMismatch(model));
+}
+
+TEST(print_without_heap)
+{
+  Max7456Model model(CS_PIN, 0);
+  char text[] = "ram";
+  unsigned long allocations;
+
+  osd.init(CS_PIN);
+  allocations = halHeapAllocations();
+  osd.print(text, 0, 2);
+  osd.print(F("flash"), 4, 2);
+  osd.printFixed(-314, 10, 2, 6, 2, '0');
+  osd.print(3.14, 17, 2, 3, 4);
+  CHECK_EQUAL(allocations, halHeapAllocations());
+  CHECK(model.text().substr(2 * 33, 32) == "|ram flash -03.14 003.1400     |");
+  CHECK(halHeapAllocations() > allocations);          // The count works
+}
+
+/******************************************************************************
+   Rendering of recorded CYCLOP++ traffic for the golden tests
+ ******************************************************************************/
+#define RENDER_SETTLE_MS    200     // Run time after the last received byte
+
+/* Renders a recording. With lostSync the input video is lost after the last
+   received byte */
+static int render(const char *recording, const char *textFile, const char *imageFile, bool lostSync)
+{
+  static Max7456Model model(CS_PIN, VSYNC_PIN);
+  unsigned long long time;
+  unsigned int data;
+  uint64_t start;
+  uint64_t end;
+  unsigned long transactions, csCycles, bytes;
+  FILE *file;
+  std::string text;
+
+  setup();
+  start = halNow() + HAL_NS_PER_MS;
+  end = start;
+  file = fopen(recording, "r");
+  if (!file) {
+    perror(recording);
+    return 2;
+  }
+  while (fscanf(file, "%llu %u", &time, &data) == 2) {
+    halUartReceive(start + time, data);
+    end = start + time;
+  }
+  fclose(file);
+
+  if (lostSync)
+    halAt(end + HAL_NS_PER_MS, []() { model.setInputVideo(MODEL_VIDEO_NONE); });
+
+  transactions = halSpiTransactions();
+  csCycles = model.csCycles();
+  bytes = model.bytes();
+  end += RENDER_SETTLE_MS * HAL_NS_PER_MS;
+  while (halNow() < end)
+    loop();
+
+  if (displayMismatch(model) >= 0) {
+    fprintf(stderr, "%s: display memory differs from the back buffer at cell %d\n",
+            recording, displayMismatch(model));
+    return 1;
+  }
+
+  text = model.text();
+  text += "spi: " + std::to_string(halSpiTransactions() - transactions) + " transactions, " +
+          std::to_string(model.csCycles() - csCycles) + " cs cycles, " +
+          std::to_string(model.bytes() - bytes) + " bytes\n";
+  file = fopen(textFile, "w");
+  if (!file) {
+    perror(textFile);
+    return 2;
+  }
+  fputs(text.c_str(), file);
+  fclose(file);
+
+  if (imageFile) {
+    file = fopen(imageFile, "wb");
+    if (!file) {
+      perror(imageFile);
+      return 2;
+    }
+    text = model.image();
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+  }
+  return 0;
+}
+
+/******************************************************************************
+   Benchmarks. The boot time and the time from the received bytes of a
+   recording to the characters in display memory are measured in virtual
+   time. They are estimates, the sketch code between the Arduino core calls
+   takes no time. The character set is decoded and the recorded CYCLOP++
+   streams are fed to the parser over and over, and their throughput is
+   measured in host time. The Atmega time of a decoded character is an
+   estimate from the cycles of its loops.
+ ******************************************************************************/
+#define BENCH_MIN_NS        200000000LL   // Measuring time per recording
+#define DECODE_CYCLES_CODE  14            // Read and classify a code byte
+#define DECODE_CYCLES_ROW   24            // Three LPM and three ST of a row
+
+/* Reads the bytes of a recording, and their receive times if times is set
+   return : false if the file can not be read */
+static bool readRecording(const char *recording, std::vector<uint8_t> &bytes,
+                          std::vector<uint64_t> *times = 0)
+{
+  unsigned long long time;
+  unsigned int data;
+  FILE *file = fopen(recording, "r");
+
+  if (!file) {
+    perror(recording);
+    return false;
+  }
+  while (fscanf(file, "%llu %u", &time, &data) == 2) {
+    bytes.push_back(data);
+    if (times)
+      times->push_back(time);
+  }
+  fclose(file);
+  return true;
+}
+
+static void runBoot(void *result, const void *arg)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+
+  *(uint64_t *)result = bootToFirstCharacter(model);
+}
+
+static int bootBenchmark(void)
+{
+  uint64_t boot;
+
+  if (!hostRunIsolated(runBoot, 0, &boot, sizeof(boot))) {
+    fprintf(stderr, "Boot failed\n");
+    return 1;
+  }
+  printf("boot to first character: %.1f ms\n", boot / 1e6);
+  return 0;
+}
+
+struct Recording {
+  std::vector<uint8_t> bytes;
+  std::vector<uint64_t> times;        // Receive times, from the recording
+};
+
+struct DisplayTimes {
+  uint64_t wire;                      // First to last received byte
+  uint64_t written;                   // First byte to last display write
+};
+
+/* Plays a recording to the MinimOSD and times the display memory writes */
+static void runDisplay(void *result, const void *arg)
+{
+  Max7456Model model(CS_PIN, VSYNC_PIN);
+  const Recording &recording = *(const Recording *)arg;
+  DisplayTimes *times = (DisplayTimes *)result;
+  uint64_t start, end, written = 0;
+  unsigned long writes;
+
+  setup();
+  start = halNow() + HAL_NS_PER_MS;
+  for (size_t i = 0; i < recording.bytes.size(); i++)
+    halUartReceive(start + recording.times[i], recording.bytes[i]);
+  start += recording.times.front();
+  end = start + recording.times.back() + RENDER_SETTLE_MS * HAL_NS_PER_MS;
+  writes = model.displayWrites();
+  while (halNow() < end) {
+    loop();
+    if (model.displayWrites() != writes) {
+      writes = model.displayWrites();
+      written = halNow();
+    }
+  }
+  times->wire = recording.times.back() - recording.times.front();
+  times->written = written > start ? written - start : 0;
+}
+
+static int displayBenchmark(int count, char **recordings)
+{
+  Recording recording;
+  DisplayTimes times;
+  const char *name;
+
+  printf("%-24s %8s %14s %16s\n", "recording", "wire ms", "on screen ms", "after last ms");
+  for (int i = 0; i < count; i++) {
+    recording.bytes.clear();
+    recording.times.clear();
+    if (!readRecording(recordings[i], recording.bytes, &recording.times))
+      return 2;
+    if (recording.bytes.empty() || !hostRunIsolated(runDisplay, &recording, &times, sizeof(times))) {
+      fprintf(stderr, "%s: display run failed\n", recordings[i]);
+      return 1;
+    }
+    name = strrchr(recordings[i], '/') ? strrchr(recordings[i], '/') + 1 : recordings[i];
+    printf("%-24s %8.1f %14.1f %16.1f\n", name, times.wire / 1e6, times.written / 1e6,
+           times.written > times.wire ? (times.written - times.wire) / 1e6 : 0.0);
+  }
+  return 0;
+}
+
+static int decodeBenchmark(void)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  charact glyph;
+  const byte *data;
+  unsigned long long glyphs = 0;
+  long long elapsed;
+  double cycles;
+
+  do {
+    data = fontData;
+    for (int c = 0; c < 256; c++)
+      data = osd.decodeCharacter(fontRows, data, glyph);
+    glyphs += 256;
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < BENCH_MIN_NS);
+
+  // Every byte of fontData is charged as a code byte, literal rows included
+  cycles = (sizeof(fontData) * DECODE_CYCLES_CODE + 256.0 * 18 * DECODE_CYCLES_ROW) / 256;
+  printf("character decode: %.1f ns per glyph on the PC, about %.0f us on the Atmega\n",
+         (double)elapsed / glyphs, cycles * 1e6 / F_CPU);
+  return 0;
+}
+
+static int parserBenchmark(int count, char **recordings)
+{
+  static Max7456Model model(CS_PIN, 0);
+  std::vector<uint8_t> bytes;
+  std::chrono::steady_clock::time_point start;
+  long long elapsed;
+  unsigned long long parsed;
+  const char *name;
+
+  osd.init(CS_PIN);
+  printf("%-24s %8s %14s\n", "recording", "bytes", "MB/s");
+  for (int i = 0; i < count; i++) {
+    bytes.clear();
+    if (!readRecording(recordings[i], bytes))
+      return 2;
+    parsed = 0;
+    start = std::chrono::steady_clock::now();
+    do {
+      ParserState state = { PARSE_TEXT, 0, 0, {0}, 0 };
+      for (size_t j = 0; j < bytes.size(); j++)
+        parseByte(state, bytes[j]);
+      parsed += bytes.size();
+      elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < BENCH_MIN_NS);
+    name = strrchr(recordings[i], '/') ? strrchr(recordings[i], '/') + 1 : recordings[i];
+    printf("%-24s %8u %14.1f\n", name, (unsigned int)bytes.size(), parsed * 1e3 / elapsed);
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  int files = 2;                    // First file argument of render
+
+  if ((argc >= 2) && !strcmp(argv[1], "test"))
+    return hostRunTests(argc > 2 ? argv[2] : 0);
+  if ((argc >= 3) && !strcmp(argv[2], "--lost-sync"))
+    files++;
+  if ((argc - files >= 2) && (argc - files <= 3) && !strcmp(argv[1], "render"))
+    return render(argv[files], argv[files + 1], argc - files == 3 ? argv[files + 2] : 0, files == 3);
+  if ((argc >= 3) && !strcmp(argv[1], "bench"))
+    return bootBenchmark() || decodeBenchmark() || displayBenchmark(argc - 2, argv + 2) ||
+           parserBenchmark(argc - 2, argv + 2);
+  fprintf(stderr, "Usage: minimosd_host test [name prefix]\n"
+                  "       minimosd_host render [--lost-sync] <recording> <text file> [<pgm file>]\n"
+                  "       minimosd_host bench <recording>...\n");
+  return 2;
+}
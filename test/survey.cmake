@@ -0,0 +1,33 @@
+# Survey export test. Turns the recording of the survey golden test into the
+# raw serial capture that survey/survey2csv.py reads, runs the script and
+# compares its CSV files with golden/survey_sweeps.csv and
+# golden/survey_samples.csv. UPDATE_GOLDEN=1 replaces them, as in golden.cmake.
+#
+# Variables: PYTHON, SCRIPT, RECORDING, GOLDEN_DIR, OUTPUT_DIR
+set(CAPTURE ${OUTPUT_DIR}/survey.bin)
+set(NAME ${OUTPUT_DIR}/survey)
+
+# A recording holds one "time byte" line per byte
+execute_process(COMMAND ${PYTHON} -c
+                        "import sys; open(sys.argv[2], 'wb').write(bytes(int(line.split()[1]) for line in open(sys.argv[1])))"
+                        ${RECORDING} ${CAPTURE}
+                RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "Conversion of ${RECORDING} failed")
+endif()
+execute_process(COMMAND ${PYTHON} ${SCRIPT} ${CAPTURE} ${NAME} RESULT_VARIABLE result)
+if(result)
+  message(FATAL_ERROR "survey2csv.py failed")
+endif()
+
+foreach(csv survey_sweeps.csv survey_samples.csv)
+  if(DEFINED ENV{UPDATE_GOLDEN})
+    file(COPY ${OUTPUT_DIR}/${csv} DESTINATION ${GOLDEN_DIR})
+  endif()
+  execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${GOLDEN_DIR}/${csv} ${OUTPUT_DIR}/${csv}
+                  RESULT_VARIABLE result)
+  if(result)
+    file(READ ${OUTPUT_DIR}/${csv} exported)
+    message(FATAL_ERROR "${csv} differs from ${GOLDEN_DIR}/${csv}:\n${exported}")
+  endif()
+endforeach()